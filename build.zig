@@ -13,26 +13,128 @@ pub fn build(b: *Builder) !void {
     //const build_v8 = b.option(bool, "build_v8", "Whether to build from v8 source") orelse false;
     const path = b.option([]const u8, "path", "Path to main file, for: build, run") orelse "";
     const use_zig_tc = b.option(bool, "zig-toolchain", "Experimental: Use zig cc/c++/ld to build v8.") orelse false;
+    const lto = b.option(bool, "lto", "Release only: Build V8 and the binding with ThinLTO. Requires -Dzig-toolchain.") orelse false;
+    const pgo = b.option([]const u8, "pgo", "Release only: \"generate\" builds an instrumented V8 for the pgo-profile step, a .profdata path builds V8 optimized with that profile.");
+    const link = b.option(V8Link, "link", "How executables link V8: static (default) or dynamic against libc_v8_shared for fast relinking.") orelse .static;
+    const preset = b.option(V8Preset, "preset", "Named set of V8 feature flags. Individual feature options override it.");
+    var features = if (preset) |p| V8Features.fromPreset(p) else V8Features{};
+    features.preset = preset;
+    inline for (@typeInfo(V8Features).Struct.fields) |field| {
+        if (field.type == ?bool) {
+            if (b.option(bool, comptime V8Features.optionName(field.name), "Sets " ++ comptime V8Features.gnName(field.name) ++ ". Defaults to the preset or V8's default.")) |val| {
+                @field(features, field.name) = val;
+            }
+        }
+    }
+    const cpu_variants = b.option([]const []const u8, "cpu-variants", "CPU models to build libc_v8 for with the v8-variants step, eg. -Dcpu-variants=x86_64_v2 -Dcpu-variants=x86_64_v3. Requires -Dzig-toolchain.") orelse &.{};
 
     const mode = b.standardOptimizeOption(.{}); //FIXED
     const target = b.standardTargetOptions(.{});
 
+    const opts = V8Options{
+        .use_zig_tc = use_zig_tc,
+        .lto = lto,
+        .features = features,
+        .link = link,
+        .pgo = if (pgo) |val| (if (std.mem.eql(u8, val, "generate")) .generate else .{ .use = b.pathFromRoot(val) }) else .none,
+    };
+    if (opts.lto and !opts.use_zig_tc) {
+        // Objects in the static lib are LLVM bitcode, so the final link needs the same LLVM that produced them.
+        std.log.err("-Dlto requires -Dzig-toolchain", .{});
+        return error.InvalidOptions;
+    }
+    if (opts.pgo != .none and mode == .Debug) {
+        // Debug builds don't set chrome_pgo_phase, so there would be nothing to profile.
+        std.log.err("-Dpgo requires a release mode", .{});
+        return error.InvalidOptions;
+    }
+    if (opts.pgo != .none and opts.use_zig_tc) {
+        // zig cc doesn't ship the clang profile runtime.
+        std.log.err("-Dpgo requires V8's clang toolchain, remove -Dzig-toolchain", .{});
+        return error.InvalidOptions;
+    }
+    if (link == .dynamic and target.result.os.tag == .windows) {
+        // binding.cpp doesn't mark its functions dllexport.
+        std.log.err("-Dlink=dynamic is not supported on Windows", .{});
+        return error.InvalidOptions;
+    }
+    if (features.sandbox == true and features.pointer_compression == false) {
+        std.log.err("-Dsandbox requires pointer compression", .{});
+        return error.InvalidOptions;
+    }
+    if (!opts.use_zig_tc) {
+        // V8's clang toolchain has no arg for the target cpu, the flags are only set through zig cc.
+        if (cpu_variants.len > 0) {
+            std.log.err("-Dcpu-variants requires -Dzig-toolchain", .{});
+            return error.InvalidOptions;
+        }
+        if (getV8Cpu(b, target) != null) {
+            std.log.warn("-Dcpu only applies to the Zig code without -Dzig-toolchain, the V8 lib stays on baseline", .{});
+        }
+    }
+
     _ = createGetTools(b);
     _ = createGetV8(b);
 
-    const v8 = try createV8_Build(b, target, mode, use_zig_tc);
+    // Every variant's gn gen reads the same root-target BUILD.gn, so it's copied once and all of them wait on it.
+    const gn_root = createV8_GnRoot(b);
+
+    const v8 = b.step("v8", "Build v8 c binding lib.");
+    try createV8_Build(b, v8, gn_root, target, mode, opts);
+
+    // Build matrix of libc_v8.a per microarchitecture. Each lands in its own v8-build/<target>/<variant> dir,
+    // and executables built with the matching -Dcpu link against it.
+    const v8_variants = b.step("v8-variants", "Build v8 c binding lib for each -Dcpu-variants model.");
+    for (cpu_variants) |name| {
+        var query = target.query;
+        query.cpu_model = .{
+            .explicit = target.result.cpu.arch.parseCpuModel(name) catch {
+                std.log.err("Unknown cpu model for {s}: {s}", .{ @tagName(target.result.cpu.arch), name });
+                return error.InvalidOptions;
+            },
+        };
+        try createV8_Build(b, v8_variants, gn_root, b.resolveTargetQuery(query), mode, opts);
+    }
 
-    const tests = createTest(b, target, mode, use_zig_tc);
+    const tests = try createTest(b, target, mode, opts);
     tests.step.dependOn(v8);
 
     const test_step = b.addRunArtifact(tests);
     b.step("test", "Run unit tests").dependOn(&test_step.step);
 
-    const build_exe = createBuildExeStep(b, path, target, mode, use_zig_tc);
+    const build_exe = try createBuildExeStep(b, path, target, mode, opts);
 
     const run_exe = b.addRunArtifact(build_exe);
     b.step("run", "Run with main file at -Dpath").dependOn(&run_exe.step);
 
+    const bench = try createExe(b, "src/bench.zig", target, mode, opts);
+    bench.step.dependOn(v8);
+    const run_bench = b.addRunArtifact(bench);
+    if (b.args) |args| {
+        run_bench.addArgs(args);
+    }
+    b.step("bench", "Run binding microbenchmarks. Pass --json after -- for machine-readable output.").dependOn(&run_bench.step);
+
+    const workloads = try createExe(b, "src/bench_workloads.zig", target, mode, opts);
+    workloads.step.dependOn(v8);
+    const run_workloads = b.addRunArtifact(workloads);
+    if (b.args) |args| {
+        run_workloads.addArgs(args);
+    }
+    b.step("bench-workloads", "Run end-to-end embedder workloads (startup, request, modules, gc).").dependOn(&run_workloads.step);
+
+    if (opts.pgo == .generate) {
+        // Run the workloads against the instrumented lib and merge the raw profiles.
+        // The result is then used with -Dpgo=v8-build/pgo/v8.profdata.
+        const clean = b.addRemoveDirTree(b.pathFromRoot(PgoRawDir));
+        const run_profile = b.addRunArtifact(workloads);
+        run_profile.setEnvironmentVariable("LLVM_PROFILE_FILE", b.fmt("{s}/v8-%p.profraw", .{b.pathFromRoot(PgoRawDir)}));
+        run_profile.step.dependOn(&clean.step);
+        const merge = b.addSystemCommand(&.{ getLlvmProfdataPath(b), "merge", "-o", b.pathFromRoot(PgoProfilePath), b.pathFromRoot(PgoRawDir) });
+        merge.step.dependOn(&run_profile.step);
+        b.step("pgo-profile", "Collect a V8 profile from the workload benchmarks. Requires -Dpgo=generate.").dependOn(&merge.step);
+    }
+
     b.default_step.dependOn(v8);
 }
 
@@ -44,25 +146,151 @@ const MinimalV8 = true;
 // Set this to false to pull the minimal required src by parsing v8/DEPS and whitelisting deps we care about.
 const UseGclient = false;
 
+const V8Options = struct {
+    use_zig_tc: bool,
+    /// ThinLTO over V8 and binding.cpp. The executable is linked with LTO as well.
+    lto: bool,
+    pgo: Pgo,
+    features: V8Features,
+    link: V8Link,
+};
+
+const V8Link = enum {
+    /// libc_v8.a is linked into every executable.
+    static,
+    /// Executables link against libc_v8_shared with an rpath to the build dir.
+    /// A binding.cpp change only relinks the shared lib, and processes share one mapped copy of V8's code pages.
+    dynamic,
+};
+
+const V8Preset = enum {
+    /// Compressed 32-bit tagged pointers roughly halve the size of the JS heap, capped at 4GB per isolate.
+    @"small-heap",
+    /// Full pointers avoid decompression on every heap access and all JIT tiers are on. Uses more memory.
+    @"max-throughput",
+    /// Interpreter only, no wasm. Smallest code size and memory, for short-lived or constrained isolates.
+    /// The WasmModuleObject and WasmStreaming bindings abort when called.
+    @"lite-mode",
+};
+
+/// V8 GN feature args. A null field keeps V8's default.
+/// Pointer compression and sandbox change V8's object layout, so embedders must link against the matching lib.
+const V8Features = struct {
+    preset: ?V8Preset = null,
+    pointer_compression: ?bool = null,
+    sandbox: ?bool = null,
+    maglev: ?bool = null,
+    sparkplug: ?bool = null,
+    webassembly: ?bool = null,
+    lite_mode: ?bool = null,
+    /// When true, the snapshot is written to snapshot_blob.bin in the ninja out dir instead of being linked into the lib.
+    /// Embedders must load it with v8.initV8ExternalStartupData (or setV8SnapshotDataBlob) before v8.initV8,
+    /// or isolates can't be created. The test and bench executables get the dir as build_options.v8_startup_data_dir.
+    use_external_startup_data: ?bool = null,
+
+    fn fromPreset(preset: V8Preset) V8Features {
+        return switch (preset) {
+            .@"small-heap" => .{
+                .pointer_compression = true,
+            },
+            .@"max-throughput" => .{
+                .pointer_compression = false,
+                // The sandbox requires pointer compression.
+                .sandbox = false,
+                .maglev = true,
+                .sparkplug = true,
+            },
+            .@"lite-mode" => .{
+                .lite_mode = true,
+                .pointer_compression = true,
+                .maglev = false,
+                .sparkplug = false,
+                .webassembly = false,
+            },
+        };
+    }
+
+    fn gnName(comptime field_name: []const u8) []const u8 {
+        // Only the startup data flag doesn't follow v8_enable_*.
+        if (std.mem.eql(u8, field_name, "use_external_startup_data")) {
+            return "v8_" ++ field_name;
+        }
+        return "v8_enable_" ++ field_name;
+    }
+
+    /// eg. pointer_compression => pointer-compression
+    fn optionName(comptime field_name: []const u8) []const u8 {
+        comptime var name: [field_name.len]u8 = undefined;
+        inline for (field_name, 0..) |ch, i| {
+            name[i] = if (ch == '_') '-' else ch;
+        }
+        const final = name;
+        return &final;
+    }
+
+    fn appendGnArgs(self: V8Features, b: *Builder, gn_args: *std.ArrayList([]const u8)) !void {
+        inline for (@typeInfo(V8Features).Struct.fields) |field| {
+            if (field.type == ?bool) {
+                if (@field(self, field.name)) |val| {
+                    try gn_args.append(b.fmt("{s}={}", .{ comptime gnName(field.name), val }));
+                }
+            }
+        }
+    }
+
+    /// Identifies the variant in the output dir. Presets keep their name, anything else is hashed.
+    fn getVariantName(self: V8Features, b: *Builder) ?[]const u8 {
+        var args = std.ArrayList([]const u8).init(b.allocator);
+        self.appendGnArgs(b, &args) catch unreachable;
+        if (args.items.len == 0) {
+            return null;
+        }
+        if (self.preset) |preset| {
+            var flags = self;
+            flags.preset = null;
+            if (std.meta.eql(flags, V8Features.fromPreset(preset))) {
+                return @tagName(preset);
+            }
+        }
+        var hasher = std.hash.Wyhash.init(0);
+        for (args.items) |arg| {
+            hasher.update(arg);
+        }
+        return b.fmt("features-{x:0>8}", .{@as(u32, @truncate(hasher.final()))});
+    }
+};
+
+const Pgo = union(enum) {
+    none,
+    /// Instrumented build that writes .profraw files when run.
+    generate,
+    /// Absolute path to a merged .profdata file.
+    use: []const u8,
+};
+
+const PgoRawDir = "v8-build/pgo/raw";
+const PgoProfilePath = "v8-build/pgo/v8.profdata";
+
 // V8's build process is complex and porting it to zig could take quite awhile.
 // It would be nice if there was a way to import .gn files into the zig build system.
 // For now we just use gn/ninja like rusty_v8 does: https://github.com/denoland/rusty_v8/blob/main/build.rs
-fn createV8_Build(b: *Builder, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, use_zig_tc: bool) !*std.Build.Step {
-    const step = b.step("v8", "Build v8 c binding lib.");
-
+/// Copies our BUILD.gn into the v8 source tree as the gn root target.
+fn createV8_GnRoot(b: *Builder) *std.Build.Step {
     if (UseGclient) {
         const mkpath = MakePathStep.create(b, "./gclient/v8/zig");
-        step.dependOn(&mkpath.step);
-
         const cp = CopyFileStep.create(b, b.pathFromRoot("BUILD.gclient.gn"), b.pathFromRoot("gclient/v8/zig/BUILD.gn"));
-        step.dependOn(&cp.step);
+        cp.step.dependOn(&mkpath.step);
+        return &cp.step;
     } else {
         const mkpath = MakePathStep.create(b, "./v8/zig");
-        step.dependOn(&mkpath.step);
-
         const cp = CopyFileStep.create(b, b.pathFromRoot("BUILD.gn"), b.pathFromRoot("v8/zig/BUILD.gn"));
-        step.dependOn(&cp.step);
+        cp.step.dependOn(&mkpath.step);
+        return &cp.step;
     }
+}
+
+fn createV8_Build(b: *Builder, step: *std.Build.Step, gn_root: *std.Build.Step, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, opts: V8Options) !void {
+    const use_zig_tc = opts.use_zig_tc;
 
     var gn_args = std.ArrayList([]const u8).init(b.allocator);
 
@@ -108,6 +336,20 @@ fn createV8_Build(b: *Builder, target: std.Build.ResolvedTarget, mode: std.built
         // https://groups.google.com/a/chromium.org/g/chromium-dev/c/-0t4s0RlmOI
         // Disable that with this:
         //try gn_args.append("chrome_pgo_phase=0");
+        // Instead, we profile with our own workloads: phase 1 instruments and phase 2 optimizes with pgo_data_path.
+        switch (opts.pgo) {
+            .none => {},
+            .generate => try gn_args.append("chrome_pgo_phase=1"),
+            .use => |profile| {
+                try gn_args.append("chrome_pgo_phase=2");
+                try gn_args.append(b.fmt("pgo_data_path=\"{s}\"", .{profile}));
+            },
+        }
+
+        if (opts.lto) {
+            // Emits bitcode into libc_v8.a so cross-module inlining happens at the final link, including into binding.cpp.
+            try gn_args.append("use_thin_lto=true");
+        }
         //if (use_zig_tc) {
         // is_official_build will enable cfi but zig does not come with the default cfi_ignorelist.
         //try zig_cppflags.append("-fno-sanitize-ignorelist");
@@ -121,6 +363,8 @@ fn createV8_Build(b: *Builder, target: std.Build.ResolvedTarget, mode: std.built
         try gn_args.append("v8_enable_i18n_support=false");
     }
 
+    try opts.features.appendGnArgs(b, &gn_args);
+
     if (mode != .Debug) {
         // TODO: document
         try gn_args.append("v8_enable_handle_zapping=false");
@@ -133,9 +377,11 @@ fn createV8_Build(b: *Builder, target: std.Build.ResolvedTarget, mode: std.built
 
     if (use_zig_tc) {
         // Set target and cpu for building the lib.
-        // TODO: If mcpu is equavalent to -Dcpu then use that instead
-        try zig_cc.append(b.fmt("zig cc --target={s} -mcpu=baseline", .{try target.result.zigTriple(b.allocator)}));
-        try zig_cxx.append(b.fmt("zig c++ --target={s} -mcpu=baseline", .{try target.result.zigTriple(b.allocator)}));
+        // Without an explicit -Dcpu, stay on baseline so the lib is portable (release libs are built on CI hosts).
+        // JIT code already detects cpu features at runtime, -Dcpu lets the C++ runtime, GC and string routines use them too.
+        const mcpu = getV8Cpu(b, target) orelse "baseline";
+        try zig_cc.append(b.fmt("zig cc --target={s} -mcpu={s}", .{ try target.result.zigTriple(b.allocator), mcpu }));
+        try zig_cxx.append(b.fmt("zig c++ --target={s} -mcpu={s}", .{ try target.result.zigTriple(b.allocator), mcpu }));
 
         try host_zig_cc.append("zig cc --target=native");
         try host_zig_cxx.append("zig c++ --target=native");
@@ -207,7 +453,8 @@ fn createV8_Build(b: *Builder, target: std.Build.ResolvedTarget, mode: std.built
                 try zig_cxx.append(sysroot_abs);
             }
         }
-        if (builtin.cpu.arch != target.result.cpu.arch or builtin.os.tag != target.result.os.tag) {
+        if (builtin.cpu.arch != target.result.cpu.arch or builtin.os.tag != target.result.os.tag or getV8Cpu(b, target) != null) {
+            // mksnapshot runs on the host, so it can't use cpu features the build machine might not have.
             try gn_args.append("v8_snapshot_toolchain=\"//zig:v8_zig_toolchain\"");
         }
 
@@ -263,12 +510,8 @@ fn createV8_Build(b: *Builder, target: std.Build.ResolvedTarget, mode: std.built
     // var check_deps = CheckV8DepsStep.create(b);
     // step.step.dependOn(&check_deps.step);
 
-    const mode_str: []const u8 = if (mode == .Debug) "debug" else "release";
     // GN will generate ninja build files in ninja_out_path which will also contain the artifacts after running ninja.
-    const ninja_out_path = try std.fmt.allocPrint(b.allocator, "v8-build/{s}/{s}/ninja", .{
-        getTargetId(b.allocator, target),
-        mode_str,
-    });
+    const ninja_out_path = getV8OutPath(b, target, mode, opts);
 
     const gn = getGnPath(b);
     const arg_items = try std.mem.join(b.allocator, " ", gn_args.items);
@@ -281,21 +524,25 @@ fn createV8_Build(b: *Builder, target: std.Build.ResolvedTarget, mode: std.built
     // cd gclient/v8 && gn desc ../../v8-build/x86_64-linux/release/ninja/ :v8 --tree
     // We can't see our own config because gn desc doesn't accept a --root-target.
     // One idea is to append our BUILD.gn to the v8 BUILD.gn instead of putting it in a subdirectory.
+    var run_gn: *std.Build.Step.Run = undefined;
     if (UseGclient) {
-        var run_gn = b.addSystemCommand(&.{ gn, "--root=gclient/v8", "--root-target=//zig", "--dotfile=.gn", "gen", ninja_out_path, args });
-        step.dependOn(&run_gn.step);
+        run_gn = b.addSystemCommand(&.{ gn, "--root=gclient/v8", "--root-target=//zig", "--dotfile=.gn", "gen", ninja_out_path, args });
     } else {
         // To see available args for gn: cd v8 && gn args --list ../v8-build/{target}/release/ninja/
-        var run_gn = b.addSystemCommand(&.{ gn, "--root=v8", "--root-target=//zig", "--dotfile=.gn", "gen", ninja_out_path, args });
-        step.dependOn(&run_gn.step);
+        run_gn = b.addSystemCommand(&.{ gn, "--root=v8", "--root-target=//zig", "--dotfile=.gn", "gen", ninja_out_path, args });
     }
+    run_gn.step.dependOn(gn_root);
+    step.dependOn(&run_gn.step);
 
     const ninja = getNinjaPath(b);
     // Only build our target. If no target is specified, ninja will build all the targets which includes developer tools, tests, etc.
-    var run_ninja = b.addSystemCommand(&.{ ninja, "-C", ninja_out_path, "c_v8" });
+    const ninja_target: []const u8 = switch (opts.link) {
+        .static => "c_v8",
+        .dynamic => "c_v8_shared",
+    };
+    var run_ninja = b.addSystemCommand(&.{ ninja, "-C", ninja_out_path, ninja_target });
+    run_ninja.step.dependOn(&run_gn.step);
     step.dependOn(&run_ninja.step);
-
-    return step;
 }
 
 fn getArchOs(alloc: std.mem.Allocator, arch: std.Target.Cpu.Arch, os: std.Target.Os.Tag) []const u8 {
@@ -306,6 +553,86 @@ fn getTargetId(alloc: std.mem.Allocator, target: std.Build.ResolvedTarget) []con
     return std.fmt.allocPrint(alloc, "{s}-{s}", .{ @tagName(target.result.cpu.arch), @tagName(target.result.os.tag) }) catch unreachable;
 }
 
+/// Returns the -mcpu value when -Dcpu was given, or null for the default baseline.
+fn getV8Cpu(b: *Builder, target: std.Build.ResolvedTarget) ?[]const u8 {
+    const query = target.query;
+    switch (query.cpu_model) {
+        .native, .explicit => {},
+        .baseline, .determined_by_arch_os => {
+            if (query.cpu_features_add.isEmpty() and query.cpu_features_sub.isEmpty()) {
+                return null;
+            }
+        },
+    }
+    return query.serializeCpuAlloc(b.allocator) catch unreachable;
+}
+
+// Each build variant gets its own output dir so switching options doesn't rebuild everything.
+fn getV8OutPath(b: *Builder, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, opts: V8Options) []const u8 {
+    var variant: []const u8 = if (mode == .Debug) "debug" else "release";
+    // Only zig cc builds the lib for the -Dcpu model, otherwise it's the baseline lib.
+    if (opts.use_zig_tc) {
+        if (getV8Cpu(b, target)) |cpu| {
+            variant = b.fmt("{s}-{s}", .{ variant, cpu });
+        }
+    }
+    if (opts.features.getVariantName(b)) |name| {
+        variant = b.fmt("{s}-{s}", .{ variant, name });
+    }
+    if (mode != .Debug) {
+        if (opts.lto) {
+            variant = b.fmt("{s}-lto", .{variant});
+        }
+        switch (opts.pgo) {
+            .none => {},
+            .generate => variant = b.fmt("{s}-pgo-gen", .{variant}),
+            .use => variant = b.fmt("{s}-pgo", .{variant}),
+        }
+    }
+    return b.fmt("v8-build/{s}/{s}/ninja", .{ getTargetId(b.allocator, target), variant });
+}
+
+// V8's bundled clang. The profile tools and runtime must match the compiler that instrumented the lib.
+const ClangBasePath = "v8/third_party/llvm-build/Release+Asserts";
+
+fn getLlvmProfdataPath(b: *Builder) []const u8 {
+    const stat = statPathFromRoot(b, ClangBasePath ++ "/bin/llvm-profdata") catch .NotExist;
+    if (stat == .File) {
+        return b.pathFromRoot(ClangBasePath ++ "/bin/llvm-profdata");
+    }
+    return "llvm-profdata";
+}
+
+/// Finds libclang_rt.profile for the target in V8's clang resource dir.
+/// Runs while the build graph is configured, so a missing toolchain is reported as an option error.
+fn getClangProfileRuntimePath(b: *Builder, target: std.Build.ResolvedTarget) ![]const u8 {
+    const clang_lib = b.pathFromRoot(ClangBasePath ++ "/lib/clang");
+    var dir = fs.openDirAbsolute(clang_lib, .{ .iterate = true }) catch {
+        std.log.err("-Dpgo=generate needs {s}, fetch the v8 toolchain first.", .{clang_lib});
+        return error.InvalidOptions;
+    };
+    defer dir.close();
+    var iter = dir.iterate();
+    while (iter.next() catch null) |entry| {
+        if (entry.kind != .directory) {
+            continue;
+        }
+        const arch = @tagName(target.result.cpu.arch);
+        const candidates = [_][]const u8{
+            b.fmt("{s}/{s}/lib/{s}-unknown-linux-gnu/libclang_rt.profile.a", .{ clang_lib, entry.name, arch }),
+            b.fmt("{s}/{s}/lib/linux/libclang_rt.profile-{s}.a", .{ clang_lib, entry.name, arch }),
+            b.fmt("{s}/{s}/lib/darwin/libclang_rt.profile_osx.a", .{ clang_lib, entry.name }),
+            b.fmt("{s}/{s}/lib/windows/clang_rt.profile-{s}.lib", .{ clang_lib, entry.name, arch }),
+        };
+        for (candidates) |path| {
+            fs.accessAbsolute(path, .{}) catch continue;
+            return path;
+        }
+    }
+    std.log.err("Could not find libclang_rt.profile for {s} in {s}", .{ @tagName(target.result.cpu.arch), clang_lib });
+    return error.InvalidOptions;
+}
+
 const CheckV8DepsStep = struct {
     const Self = @This();
 
@@ -474,15 +801,41 @@ const CopyFileStep = struct {
 };
 
 // TODO: Make this usable from external project.
-fn linkV8(b: *Builder, step: *std.Build.Step.Compile, mode: std.builtin.OptimizeMode, target: std.Build.ResolvedTarget, use_zig_tc: bool) void {
-    const mode_str: []const u8 = if (mode == .Debug) "debug" else "release";
+fn linkV8(b: *Builder, step: *std.Build.Step.Compile, mode: std.builtin.OptimizeMode, target: std.Build.ResolvedTarget, opts: V8Options) !void {
+    const use_zig_tc = opts.use_zig_tc;
+
+    // Lets the tests and benchmarks find snapshot_blob.bin when the lib was built without an embedded snapshot.
+    const build_options = b.addOptions();
+    const startup_data_dir: ?[:0]const u8 = if (opts.features.use_external_startup_data == true)
+        try b.allocator.dupeZ(u8, b.pathFromRoot(getV8OutPath(b, target, mode, opts)))
+    else
+        null;
+    build_options.addOption(?[:0]const u8, "v8_startup_data_dir", startup_data_dir);
+    step.root_module.addOptions("build_options", build_options);
+
+    if (opts.link == .dynamic) {
+        // Shared libs are placed at the root of the ninja out dir.
+        const out_path = b.pathFromRoot(getV8OutPath(b, target, mode, opts));
+        step.addLibraryPath(.{ .cwd_relative = out_path });
+        step.addRPath(.{ .cwd_relative = out_path });
+        step.linkSystemLibrary2("c_v8_shared", .{ .use_pkg_config = .no });
+        if (use_zig_tc) {
+            step.linkLibCpp();
+        }
+        return;
+    }
     const lib: []const u8 = if (target.result.os.tag == .windows and target.result.abi == .msvc) "c_v8.lib" else "libc_v8.a";
-    const lib_path = std.fmt.allocPrint(b.allocator, "./v8-build/{s}/{s}/ninja/obj/zig/{s}", .{
-        getTargetId(b.allocator, target),
-        mode_str,
-        lib,
-    }) catch unreachable;
+    const lib_path = b.fmt("./{s}/obj/zig/{s}", .{ getV8OutPath(b, target, mode, opts), lib });
     step.addAssemblyFile(b.path(lib_path));
+    if (mode != .Debug) {
+        if (opts.lto) {
+            step.want_lto = true;
+        }
+        if (opts.pgo == .generate) {
+            // Instrumented objects call into the profile runtime to write .profraw files on exit.
+            step.addObjectFile(.{ .cwd_relative = try getClangProfileRuntimePath(b, target) });
+        }
+    }
     if (builtin.os.tag == .linux) {
         if (use_zig_tc) {
             // TODO: This should be linked already when we built v8.
@@ -506,7 +859,7 @@ fn linkV8(b: *Builder, step: *std.Build.Step.Compile, mode: std.builtin.Optimize
     }
 }
 
-fn createTest(b: *Builder, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, use_zig_tc: bool) *std.Build.Step.Compile {
+fn createTest(b: *Builder, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, opts: V8Options) !*std.Build.Step.Compile {
     const step = b.addTest(.{
         .root_source_file = b.path("src/test.zig"),
         .target = target,
@@ -516,7 +869,30 @@ fn createTest(b: *Builder, target: std.Build.ResolvedTarget, mode: std.builtin.O
     step.addIncludePath(b.path("src"));
     step.linkLibC();
 
-    linkV8(b, step, mode, target, use_zig_tc);
+    try linkV8(b, step, mode, target, opts);
+
+    return step;
+}
+
+/// Shared setup for executables rooted at `path`: named after the file, linked against libc and V8.
+fn createExe(b: *Builder, path: []const u8, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, opts: V8Options) !*std.Build.Step.Compile {
+    const basename = std.fs.path.basename(path);
+    const i = std.mem.indexOf(u8, basename, ".zig") orelse basename.len;
+    const name = basename[0..i];
+
+    const step = b.addExecutable(.{
+        .target = target,
+        .root_source_file = b.path(path),
+        .name = name,
+        .optimize = mode,
+    }); //FIXED
+    //step.setBuildMode(mode);
+    //step.setTarget(target);
+
+    step.linkLibC();
+    step.addIncludePath(b.path("src"));
+
+    try linkV8(b, step, mode, target, opts);
 
     return step;
 }
@@ -708,31 +1084,15 @@ pub const GetV8SourceStep = struct {
     }
 };
 
-fn createBuildExeStep(b: *Builder, path: []const u8, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, use_zig_tc: bool) *std.Build.Step.Compile {
+fn createBuildExeStep(b: *Builder, path: []const u8, target: std.Build.ResolvedTarget, mode: std.builtin.OptimizeMode, opts: V8Options) !*std.Build.Step.Compile {
     _ = b.step("exe", "Build exe with main file at -Dpath");
 
-    const basename = std.fs.path.basename(path);
-    const i = std.mem.indexOf(u8, basename, ".zig") orelse basename.len;
-    const name = basename[0..i];
-
-    const step = b.addExecutable(.{
-        .target = target,
-        .root_source_file = b.path(path),
-        .name = name,
-        .optimize = mode,
-    }); //FIXED
-    //step.setBuildMode(mode);
-    //step.setTarget(target);
-
-    step.linkLibC();
-    step.addIncludePath(b.path("src"));
+    const step = try createExe(b, path, target, mode, opts);
 
     if (mode == .ReleaseSafe) {
         step.root_module.strip = true;
     }
 
-    linkV8(b, step, mode, target, use_zig_tc);
-
     return step;
 }
 
@@ -0,0 +1,323 @@
+const std = @import("std");
+const v8 = @import("v8.zig");
+const build_options = @import("build_options");
+
+// Microbenchmarks for the binding layer.
+// Each case times the same operation over many batches and reports ns/op (mean, p50, p99),
+// v8 heap bytes per op and bytes malloced by v8 outside the heap per op.
+//
+// zig build bench -Doptimize=ReleaseFast
+// zig build bench -Doptimize=ReleaseFast -- --json > bench.json
+// zig build bench -Doptimize=ReleaseFast -- --filter object_
+
+/// Number of timed batches per case. Percentiles are taken over batches.
+const SampleCount = 200;
+/// Operations per batch. A batch runs inside its own HandleScope.
+const BatchSize = 1000;
+const WarmupBatches = 20;
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{}){};
+    defer _ = gpa.deinit();
+    const alloc = gpa.allocator();
+
+    var json_out = false;
+    var filter: ?[]const u8 = null;
+    const args = try std.process.argsAlloc(alloc);
+    defer std.process.argsFree(alloc, args);
+    var i: usize = 1;
+    while (i < args.len) : (i += 1) {
+        if (std.mem.eql(u8, args[i], "--json")) {
+            json_out = true;
+        } else if (std.mem.eql(u8, args[i], "--filter") and i + 1 < args.len) {
+            i += 1;
+            filter = args[i];
+        }
+    }
+
+    const platform = v8.Platform.initDefault(0, true);
+    defer platform.deinit();
+
+    v8.initV8Platform(platform);
+    defer v8.deinitV8Platform();
+
+    if (build_options.v8_startup_data_dir) |dir| {
+        v8.initV8ExternalStartupData(dir);
+    }
+    v8.initV8();
+    defer _ = v8.deinitV8();
+
+    var params = v8.initCreateParams();
+    params.array_buffer_allocator = v8.createDefaultArrayBufferAllocator();
+    defer v8.destroyArrayBufferAllocator(params.array_buffer_allocator.?);
+    var isolate = v8.Isolate.init(&params);
+    defer isolate.deinit();
+
+    isolate.enter();
+    defer isolate.exit();
+
+    var hscope: v8.HandleScope = undefined;
+    hscope.init(isolate);
+    defer hscope.deinit();
+
+    var context = v8.Context.init(isolate, null, null);
+    context.enter();
+    defer context.exit();
+
+    var env = try Env.init(alloc, isolate, context);
+    defer env.deinit();
+
+    var results = std.ArrayList(Result).init(alloc);
+    defer results.deinit();
+
+    for (Cases) |case| {
+        if (filter) |f| {
+            if (std.mem.indexOf(u8, case.name, f) == null) {
+                continue;
+            }
+        }
+        try results.append(runCase(&env, case));
+    }
+
+    if (json_out) {
+        try writeJson(std.io.getStdOut().writer(), "bindings", results.items);
+    } else {
+        printTable(results.items);
+    }
+}
+
+/// State shared by the cases. Handles created here live in main's HandleScope.
+const Env = struct {
+    alloc: std.mem.Allocator,
+    isolate: v8.Isolate,
+    ctx: v8.Context,
+    str: v8.String,
+    str_buf: []u8,
+    obj: v8.Object,
+    key: v8.String,
+    num: v8.Number,
+    add_fn: v8.Function,
+    call_native_fn: v8.Function,
+    native_fn: v8.Function,
+    json_src: v8.String,
+
+    fn init(alloc: std.mem.Allocator, isolate: v8.Isolate, ctx: v8.Context) !Env {
+        const str = v8.String.initUtf8(isolate, "The quick brown fox jumps over the lazy dog 🍏");
+        const key = v8.String.initUtf8Internalized(isolate, "value");
+        const obj = v8.Object.init(isolate);
+        _ = obj.setValue(ctx, key, v8.Number.init(isolate, 1));
+        return .{
+            .alloc = alloc,
+            .isolate = isolate,
+            .ctx = ctx,
+            .str = str,
+            .str_buf = try alloc.alloc(u8, str.lenUtf8(isolate)),
+            .obj = obj,
+            .key = key,
+            .num = v8.Number.init(isolate, 2),
+            .add_fn = try evalFunction(isolate, ctx, "(function (a, b) { return a + b; })"),
+            .call_native_fn = try evalFunction(isolate, ctx, "(function (f, n) { for (let i = 0; i < n; i++) f(1, 2, 3, 4); })"),
+            .native_fn = v8.FunctionTemplate.initCallback(isolate, nativeGetArgs).getFunction(ctx),
+            .json_src = v8.String.initUtf8(isolate, "{\"id\":1234,\"name\":\"bench\",\"tags\":[\"a\",\"b\",\"c\"],\"score\":0.5}"),
+        };
+    }
+
+    fn deinit(self: *Env) void {
+        self.alloc.free(self.str_buf);
+    }
+};
+
+pub fn evalFunction(isolate: v8.Isolate, ctx: v8.Context, src: []const u8) !v8.Function {
+    const script = try v8.Script.compile(ctx, v8.String.initUtf8(isolate, src), null);
+    const val = try script.run(ctx);
+    return val.castTo(v8.Function);
+}
+
+fn nativeGetArgs(raw_info: ?*const v8.C_FunctionCallbackInfo) callconv(.C) void {
+    const info = v8.FunctionCallbackInfo.initFromV8(raw_info);
+    var i: u32 = 0;
+    while (i < info.length()) : (i += 1) {
+        std.mem.doNotOptimizeAway(info.getArg(i).handle);
+    }
+}
+
+const Case = struct {
+    name: []const u8,
+    /// Runs BatchSize operations.
+    run: *const fn (env: *Env) anyerror!void,
+};
+
+const Cases = [_]Case{
+    .{ .name = "string_init_utf8", .run = benchStringInitUtf8 },
+    .{ .name = "string_write_utf8", .run = benchStringWriteUtf8 },
+    .{ .name = "object_get_value", .run = benchObjectGetValue },
+    .{ .name = "object_set_value", .run = benchObjectSetValue },
+    .{ .name = "function_call", .run = benchFunctionCall },
+    .{ .name = "callback_get_arg", .run = benchCallbackGetArg },
+    .{ .name = "json_parse", .run = benchJsonParse },
+    .{ .name = "persistent_init", .run = benchPersistentInit },
+    .{ .name = "handle_scope_churn", .run = benchHandleScopeChurn },
+};
+
+fn benchStringInitUtf8(env: *Env) !void {
+    for (0..BatchSize) |_| {
+        std.mem.doNotOptimizeAway(v8.String.initUtf8(env.isolate, "hello world").handle);
+    }
+}
+
+fn benchStringWriteUtf8(env: *Env) !void {
+    for (0..BatchSize) |_| {
+        std.mem.doNotOptimizeAway(env.str.writeUtf8(env.isolate, env.str_buf));
+    }
+}
+
+fn benchObjectGetValue(env: *Env) !void {
+    for (0..BatchSize) |_| {
+        std.mem.doNotOptimizeAway((try env.obj.getValue(env.ctx, env.key)).handle);
+    }
+}
+
+fn benchObjectSetValue(env: *Env) !void {
+    for (0..BatchSize) |_| {
+        std.mem.doNotOptimizeAway(env.obj.setValue(env.ctx, env.key, env.num));
+    }
+}
+
+fn benchFunctionCall(env: *Env) !void {
+    const args = [_]v8.Value{ env.num.toValue(), env.num.toValue() };
+    for (0..BatchSize) |_| {
+        const res = env.add_fn.call(env.ctx, env.obj, &args) orelse return error.JsException;
+        std.mem.doNotOptimizeAway(res.handle);
+    }
+}
+
+/// One batch is a single JS loop that calls a native function BatchSize times, so this measures the
+/// JS to native transition plus four getArg calls per op.
+fn benchCallbackGetArg(env: *Env) !void {
+    const args = [_]v8.Value{ env.native_fn.toValue(), v8.Number.init(env.isolate, BatchSize).toValue() };
+    _ = env.call_native_fn.call(env.ctx, env.obj, &args) orelse return error.JsException;
+}
+
+fn benchJsonParse(env: *Env) !void {
+    for (0..BatchSize) |_| {
+        std.mem.doNotOptimizeAway((try v8.Json.parse(env.ctx, env.json_src)).handle);
+    }
+}
+
+fn benchPersistentInit(env: *Env) !void {
+    for (0..BatchSize) |_| {
+        var p = v8.Persistent(v8.Object).init(env.isolate, env.obj);
+        p.deinit();
+    }
+}
+
+fn benchHandleScopeChurn(env: *Env) !void {
+    for (0..BatchSize) |_| {
+        var hscope: v8.HandleScope = undefined;
+        hscope.init(env.isolate);
+        defer hscope.deinit();
+        std.mem.doNotOptimizeAway(v8.Number.init(env.isolate, 1).handle);
+    }
+}
+
+pub const Result = struct {
+    name: []const u8,
+    ops: u64,
+    mean_ns: f64,
+    p50_ns: f64,
+    p99_ns: f64,
+    /// Growth of the v8 used heap size, per op. Batches where a GC shrank the heap count as zero,
+    /// so this is a lower bound.
+    heap_bytes_per_op: f64,
+    /// Growth of the memory v8 malloced outside its heap (HeapStatistics.malloced_memory), per op.
+    /// Counted the same way as heap_bytes_per_op.
+    malloced_bytes_per_op: f64,
+};
+
+fn runCase(env: *Env, case: Case) Result {
+    for (0..WarmupBatches) |_| {
+        runBatch(env, case);
+    }
+
+    var samples: [SampleCount]f64 = undefined;
+    var heap_bytes: u64 = 0;
+    var malloced_bytes: u64 = 0;
+    for (&samples) |*sample| {
+        const start = env.isolate.getHeapStatistics();
+        var timer = std.time.Timer.start() catch unreachable;
+        runBatch(env, case);
+        const elapsed = timer.read();
+        const end = env.isolate.getHeapStatistics();
+        if (end.used_heap_size > start.used_heap_size) {
+            heap_bytes += end.used_heap_size - start.used_heap_size;
+        }
+        if (end.malloced_memory > start.malloced_memory) {
+            malloced_bytes += end.malloced_memory - start.malloced_memory;
+        }
+        sample.* = @as(f64, @floatFromInt(elapsed)) / BatchSize;
+    }
+    const ops: u64 = SampleCount * BatchSize;
+    const stats = Stats.init(&samples);
+    return .{
+        .name = case.name,
+        .ops = ops,
+        .mean_ns = stats.mean,
+        .p50_ns = stats.p50,
+        .p99_ns = stats.p99,
+        .heap_bytes_per_op = @as(f64, @floatFromInt(heap_bytes)) / @as(f64, @floatFromInt(ops)),
+        .malloced_bytes_per_op = @as(f64, @floatFromInt(malloced_bytes)) / @as(f64, @floatFromInt(ops)),
+    };
+}
+
+fn runBatch(env: *Env, case: Case) void {
+    var hscope: v8.HandleScope = undefined;
+    hscope.init(env.isolate);
+    defer hscope.deinit();
+    case.run(env) catch |err| {
+        std.debug.panic("{s} failed: {}", .{ case.name, err });
+    };
+}
+
+/// Summary of a set of samples. Sorts the samples in place.
+pub const Stats = struct {
+    mean: f64,
+    p50: f64,
+    p99: f64,
+
+    pub fn init(samples: []f64) Stats {
+        std.mem.sort(f64, samples, {}, std.sort.asc(f64));
+        var sum: f64 = 0;
+        for (samples) |s| {
+            sum += s;
+        }
+        return .{
+            .mean = sum / @as(f64, @floatFromInt(samples.len)),
+            .p50 = percentile(samples, 50),
+            .p99 = percentile(samples, 99),
+        };
+    }
+
+    /// Nearest-rank percentile of sorted samples.
+    pub fn percentile(sorted: []const f64, p: u32) f64 {
+        const rank = (sorted.len * p + 99) / 100;
+        return sorted[if (rank == 0) 0 else rank - 1];
+    }
+};
+
+/// Writes one JSON object per run so results can be appended to a file and tracked over time.
+pub fn writeJson(writer: anytype, suite: []const u8, results: anytype) !void {
+    try std.json.stringify(.{
+        .suite = suite,
+        .v8_version = v8.getVersion(),
+        .timestamp = std.time.timestamp(),
+        .results = results,
+    }, .{}, writer);
+    try writer.writeByte('\n');
+}
+
+fn printTable(results: []const Result) void {
+    std.debug.print("{s:<24} {s:>12} {s:>12} {s:>12} {s:>12} {s:>12}\n", .{ "name", "mean ns/op", "p50 ns/op", "p99 ns/op", "heap B/op", "malloc B/op" });
+    for (results) |r| {
+        std.debug.print("{s:<24} {d:>12.1} {d:>12.1} {d:>12.1} {d:>12.1} {d:>12.1}\n", .{ r.name, r.mean_ns, r.p50_ns, r.p99_ns, r.heap_bytes_per_op, r.malloced_bytes_per_op });
+    }
+}
@@ -0,0 +1,334 @@
+const std = @import("std");
+const builtin = @import("builtin");
+const v8 = @import("v8.zig");
+const build_options = @import("build_options");
+const bench = @import("bench.zig");
+
+// End-to-end embedder workloads. Each reports throughput, per-iteration latency (mean, p50, p99) and RSS.
+// Peak RSS only grows within a process, so run one workload at a time with --workload when comparing it.
+//
+// zig build bench-workloads -Doptimize=ReleaseFast
+// zig build bench-workloads -Doptimize=ReleaseFast -- --workload request --json >> workloads.jsonl
+
+pub fn main() !void {
+    var gpa = std.heap.GeneralPurposeAllocator(.{}){};
+    defer _ = gpa.deinit();
+    const alloc = gpa.allocator();
+
+    var json_out = false;
+    var filter: ?[]const u8 = null;
+    const args = try std.process.argsAlloc(alloc);
+    defer std.process.argsFree(alloc, args);
+    var i: usize = 1;
+    while (i < args.len) : (i += 1) {
+        if (std.mem.eql(u8, args[i], "--json")) {
+            json_out = true;
+        } else if (std.mem.eql(u8, args[i], "--workload") and i + 1 < args.len) {
+            i += 1;
+            filter = args[i];
+        }
+    }
+
+    const platform = v8.Platform.initDefault(0, true);
+    defer platform.deinit();
+
+    v8.initV8Platform(platform);
+    defer v8.deinitV8Platform();
+
+    if (build_options.v8_startup_data_dir) |dir| {
+        v8.initV8ExternalStartupData(dir);
+    }
+    v8.initV8();
+    defer _ = v8.deinitV8();
+
+    var results = std.ArrayList(Result).init(alloc);
+    defer results.deinit();
+
+    for (Workloads) |workload| {
+        if (filter) |f| {
+            if (!std.mem.eql(u8, workload.name, f)) {
+                continue;
+            }
+        }
+        const samples = try alloc.alloc(f64, workload.iterations);
+        defer alloc.free(samples);
+
+        var timer = try std.time.Timer.start();
+        try workload.run(alloc, platform, samples);
+        const total_ns = timer.read();
+
+        const stats = bench.Stats.init(samples);
+        try results.append(.{
+            .name = workload.name,
+            .iterations = workload.iterations,
+            .throughput_per_sec = @as(f64, @floatFromInt(workload.iterations)) / (@as(f64, @floatFromInt(total_ns)) / std.time.ns_per_s),
+            .mean_ns = stats.mean,
+            .p50_ns = stats.p50,
+            .p99_ns = stats.p99,
+            .rss_bytes = getRss(),
+            .peak_rss_bytes = getPeakRss(),
+        });
+    }
+
+    if (json_out) {
+        try bench.writeJson(std.io.getStdOut().writer(), "workloads", results.items);
+    } else {
+        printTable(results.items);
+    }
+}
+
+const Result = struct {
+    name: []const u8,
+    iterations: u32,
+    throughput_per_sec: f64,
+    mean_ns: f64,
+    p50_ns: f64,
+    p99_ns: f64,
+    /// Resident set size after the workload. Falls back to the peak where the current size isn't available.
+    rss_bytes: u64,
+    peak_rss_bytes: u64,
+};
+
+const Workload = struct {
+    name: []const u8,
+    iterations: u32,
+    /// Runs the workload and writes the latency of each iteration in ns to samples.
+    run: *const fn (alloc: std.mem.Allocator, platform: v8.Platform, samples: []f64) anyerror!void,
+};
+
+const Workloads = [_]Workload{
+    .{ .name = "startup", .iterations = 200, .run = runStartup },
+    .{ .name = "request", .iterations = 50_000, .run = runRequest },
+    .{ .name = "modules", .iterations = 200, .run = runModules },
+    .{ .name = "gc", .iterations = 5_000, .run = runGc },
+};
+
+/// Owns an isolate with one entered context.
+const Runtime = struct {
+    params: v8.C_CreateParams,
+    isolate: v8.Isolate,
+    hscope: v8.HandleScope,
+    context: v8.Context,
+
+    /// Constructs in place since the HandleScope can't be moved.
+    fn init(self: *Runtime) void {
+        self.params = v8.initCreateParams();
+        self.params.array_buffer_allocator = v8.createDefaultArrayBufferAllocator();
+        self.isolate = v8.Isolate.init(&self.params);
+        self.isolate.enter();
+        self.hscope.init(self.isolate);
+        self.context = v8.Context.init(self.isolate, null, null);
+        self.context.enter();
+    }
+
+    fn deinit(self: *Runtime) void {
+        self.context.exit();
+        self.hscope.deinit();
+        self.isolate.exit();
+        self.isolate.deinit();
+        v8.destroyArrayBufferAllocator(self.params.array_buffer_allocator.?);
+    }
+};
+
+/// Isolate and context creation through first script execution, then teardown.
+fn runStartup(_: std.mem.Allocator, _: v8.Platform, samples: []f64) !void {
+    for (samples) |*sample| {
+        var timer = try std.time.Timer.start();
+        var rt: Runtime = undefined;
+        rt.init();
+        const script = try v8.Script.compile(rt.context, v8.String.initUtf8(rt.isolate, "1 + 1"), null);
+        _ = try script.run(rt.context);
+        rt.deinit();
+        sample.* = @floatFromInt(timer.read());
+    }
+}
+
+const RequestHandler =
+    \\(function (req) {
+    \\  const o = JSON.parse(req);
+    \\  const items = o.items.map((x) => x * 2);
+    \\  return JSON.stringify({ id: o.id, user: o.user, total: items.reduce((a, b) => a + b, 0), items });
+    \\})
+;
+
+/// A request/response loop: a JSON payload goes in as a string, a JS handler parses it and the response is copied out.
+fn runRequest(_: std.mem.Allocator, _: v8.Platform, samples: []f64) !void {
+    var rt: Runtime = undefined;
+    rt.init();
+    defer rt.deinit();
+
+    const handler = try bench.evalFunction(rt.isolate, rt.context, RequestHandler);
+    const recv = rt.context.getGlobal();
+    var req_buf: [256]u8 = undefined;
+    var res_buf: [512]u8 = undefined;
+
+    for (samples, 0..) |*sample, id| {
+        var timer = try std.time.Timer.start();
+
+        var hscope: v8.HandleScope = undefined;
+        hscope.init(rt.isolate);
+        defer hscope.deinit();
+
+        const req = try std.fmt.bufPrint(&req_buf, "{{\"id\":{},\"user\":\"user{}\",\"items\":[1,2,3,4,5,6,7,8]}}", .{ id, id % 100 });
+        const args = [_]v8.Value{v8.String.initUtf8(rt.isolate, req).toValue()};
+        const res = handler.call(rt.context, recv, &args) orelse return error.JsException;
+        const len = (try res.toString(rt.context)).writeUtf8(rt.isolate, &res_buf);
+        std.mem.doNotOptimizeAway(res_buf[0..len]);
+
+        sample.* = @floatFromInt(timer.read());
+    }
+}
+
+const ModuleCount = 50;
+/// The modules of the graph being instantiated, indexed by specifier "m<idx>".
+var g_modules: [ModuleCount]v8.Module = undefined;
+
+/// Compiles, links and evaluates a graph of ModuleCount leaf modules plus an entry module that imports them all,
+/// each iteration in a fresh context.
+fn runModules(alloc: std.mem.Allocator, _: v8.Platform, samples: []f64) !void {
+    var rt: Runtime = undefined;
+    rt.init();
+    defer rt.deinit();
+
+    var sources: [ModuleCount][]const u8 = undefined;
+    for (&sources, 0..) |*src, idx| {
+        src.* = try std.fmt.allocPrint(alloc, "export function f{}(x) {{ return x + {}; }}\nexport const name = 'm{}';\n", .{ idx, idx, idx });
+    }
+    defer for (sources) |src| {
+        alloc.free(src);
+    };
+
+    var entry_src = std.ArrayList(u8).init(alloc);
+    defer entry_src.deinit();
+    for (0..ModuleCount) |idx| {
+        try entry_src.writer().print("import {{ f{} }} from 'm{}';\n", .{ idx, idx });
+    }
+    try entry_src.appendSlice("globalThis.result = 0");
+    for (0..ModuleCount) |idx| {
+        try entry_src.writer().print(" + f{}(1)", .{idx});
+    }
+    try entry_src.appendSlice(";\n");
+
+    for (samples) |*sample| {
+        var timer = try std.time.Timer.start();
+
+        var hscope: v8.HandleScope = undefined;
+        hscope.init(rt.isolate);
+        defer hscope.deinit();
+
+        const ctx = v8.Context.init(rt.isolate, null, null);
+        ctx.enter();
+        defer ctx.exit();
+
+        for (sources, 0..) |src, idx| {
+            var name_buf: [16]u8 = undefined;
+            const name = try std.fmt.bufPrint(&name_buf, "m{}", .{idx});
+            g_modules[idx] = try compileModule(rt.isolate, name, src);
+        }
+        const entry = try compileModule(rt.isolate, "entry", entry_src.items);
+        if (!try entry.instantiate(ctx, resolveModule)) {
+            return error.InstantiateFailed;
+        }
+        _ = try entry.evaluate(ctx);
+
+        sample.* = @floatFromInt(timer.read());
+    }
+}
+
+fn compileModule(isolate: v8.Isolate, name: []const u8, src: []const u8) !v8.Module {
+    const origin = v8.ScriptOrigin.init(isolate, v8.String.initUtf8(isolate, name).toValue(), 0, 0, false, -1, null, false, false, true, null);
+    var source: v8.ScriptCompilerSource = undefined;
+    source.init(v8.String.initUtf8(isolate, src), origin, null);
+    defer source.deinit();
+    return v8.ScriptCompiler.compileModule(isolate, &source, .kNoCompileOptions, .kNoCacheNoReason);
+}
+
+fn resolveModule(
+    c_ctx: ?*const v8.C_Context,
+    c_spec: ?*const v8.C_Value,
+    _: ?*const v8.C_FixedArray,
+    _: ?*const v8.C_Module,
+) callconv(.C) ?*const v8.C_Module {
+    const ctx = v8.Context{ .handle = c_ctx.? };
+    const spec = v8.String{ .handle = c_spec.? };
+    var buf: [16]u8 = undefined;
+    const len = spec.writeUtf8(ctx.getIsolate(), &buf);
+    if (len < 2 or buf[0] != 'm') {
+        return null;
+    }
+    const idx = std.fmt.parseInt(usize, buf[1..len], 10) catch return null;
+    if (idx >= ModuleCount) {
+        return null;
+    }
+    return g_modules[idx].handle;
+}
+
+const GcTick =
+    \\(function () {
+    \\  const ring = new Array(16384);
+    \\  let pos = 0;
+    \\  return function tick() {
+    \\    for (let i = 0; i < 1000; i++) {
+    \\      ring[pos] = { id: i, label: 'obj' + i, pair: [i, i + 1] };
+    \\      pos = (pos + 1) & 16383;
+    \\    }
+    \\  };
+    \\})()
+;
+
+/// Sustained allocation with a bounded live set, so young and old generation collections happen during the run.
+/// GC pauses show up in the p99 latency of a tick.
+fn runGc(_: std.mem.Allocator, _: v8.Platform, samples: []f64) !void {
+    var rt: Runtime = undefined;
+    rt.init();
+    defer rt.deinit();
+
+    const tick = try bench.evalFunction(rt.isolate, rt.context, GcTick);
+    const recv = rt.context.getGlobal();
+
+    for (samples) |*sample| {
+        var timer = try std.time.Timer.start();
+        _ = tick.call(rt.context, recv, &.{}) orelse return error.JsException;
+        sample.* = @floatFromInt(timer.read());
+    }
+}
+
+fn getPeakRss() u64 {
+    if (builtin.os.tag == .windows) {
+        return 0;
+    } else {
+        const usage = std.posix.getrusage(std.posix.rusage.SELF);
+        const max: u64 = @intCast(usage.maxrss);
+        // Reported in bytes on macOS and kilobytes elsewhere.
+        return if (builtin.os.tag.isDarwin()) max else max * 1024;
+    }
+}
+
+fn getRss() u64 {
+    if (builtin.os.tag != .linux) {
+        return getPeakRss();
+    }
+    // statm reports pages: size resident shared ...
+    var buf: [128]u8 = undefined;
+    const statm = std.fs.cwd().readFile("/proc/self/statm", &buf) catch return getPeakRss();
+    var it = std.mem.tokenizeScalar(u8, statm, ' ');
+    _ = it.next();
+    const resident = std.fmt.parseInt(u64, it.next() orelse return getPeakRss(), 10) catch return getPeakRss();
+    return resident * std.mem.page_size;
+}
+
+fn printTable(results: []const Result) void {
+    std.debug.print("{s:<12} {s:>10} {s:>14} {s:>12} {s:>12} {s:>12} {s:>10} {s:>10}\n", .{ "workload", "iters", "ops/s", "mean us", "p50 us", "p99 us", "rss MB", "peak MB" });
+    for (results) |r| {
+        std.debug.print("{s:<12} {d:>10} {d:>14.1} {d:>12.2} {d:>12.2} {d:>12.2} {d:>10.1} {d:>10.1}\n", .{
+            r.name,
+            r.iterations,
+            r.throughput_per_sec,
+            r.mean_ns / std.time.ns_per_us,
+            r.p50_ns / std.time.ns_per_us,
+            r.p99_ns / std.time.ns_per_us,
+            @as(f64, @floatFromInt(r.rss_bytes)) / (1024 * 1024),
+            @as(f64, @floatFromInt(r.peak_rss_bytes)) / (1024 * 1024),
+        });
+    }
+}
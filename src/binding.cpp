@@ -1,9 +1,19 @@
 // Based on https://github.com/denoland/rusty_v8/blob/main/src/binding.cc
 
+#include <algorithm>
 #include <cassert>
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/platform.h"
+#include "include/cppgc/visitor.h"
 #include "include/libplatform/libplatform.h"
 #include "include/v8.h"
+#include "include/v8-cppgc.h"
 #include "src/api/api.h"
+#if V8_ENABLE_WEBASSEMBLY
+#include "src/wasm/wasm-serialization.h"
+#endif
 
 template <class T, class... Args>
 class Wrapper {
@@ -93,6 +103,71 @@ struct make_pod {
     };
 };
 
+// Creates every element handle in a nested scope so only the array escapes into the caller's scope.
+template <class T, class F>
+inline static const v8::Array* new_array_from(
+        v8::Isolate* isolate,
+        const T* elements,
+        size_t length,
+        F new_value) {
+    v8::EscapableHandleScope scope(isolate);
+    std::vector<v8::Local<v8::Value>> values;
+    values.reserve(length);
+    for (size_t i = 0; i < length; i++) {
+        values.push_back(new_value(isolate, elements[i]));
+    }
+    return local_to_ptr(scope.Escape(v8::Array::New(isolate, values.data(), length)));
+}
+
+struct GcObjectVtable {
+    void (*trace)(const void* data, cppgc::Visitor* visitor);
+    void (*finalize)(void* data);
+};
+
+typedef void (*GcObjectInit)(void* data, const void* init_data);
+
+// A cppgc object whose Zig payload is allocated inline right after it.
+// Tracing and finalization are forwarded to the payload through the vtable.
+// The payload is zeroed and initialized before MakeGarbageCollected returns, since concurrent marking can trace
+// the object as soon as it's published. Zeroed memory is a valid empty TracedReference and Member.
+class GcObject final : public cppgc::GarbageCollected<GcObject> {
+    public:
+        GcObject(const GcObjectVtable* vtable, size_t size, GcObjectInit init, const void* init_data) : vtable_(vtable) {
+            memset(Data(), 0, size);
+            if (init != nullptr) {
+                init(Data(), init_data);
+            }
+        }
+
+        ~GcObject() {
+            if (vtable_->finalize != nullptr) {
+                vtable_->finalize(Data());
+            }
+        }
+
+        void Trace(cppgc::Visitor* visitor) const {
+            if (vtable_->trace != nullptr) {
+                vtable_->trace(Data(), visitor);
+            }
+        }
+
+        void* Data() const {
+            return const_cast<GcObject*>(this) + 1;
+        }
+
+    private:
+        const GcObjectVtable* vtable_;
+};
+
+// The payload starts right after the object, which keeps it aligned to the allocation granularity.
+static_assert(sizeof(GcObject) % 8 == 0, "GcObject payload must be 8 byte aligned");
+
+// Only the C API is exported from c_v8_shared, which is otherwise built with hidden visibility.
+// Template instantiations from the V8 and libc++ headers keep the visibility of their declarations.
+#if defined(__GNUC__)
+#pragma GCC visibility push(default)
+#endif
+
 extern "C" {
 
 // Platform
@@ -119,6 +194,17 @@ bool v8__Platform__PumpMessageLoop(
         wait_for_work ? v8::platform::MessageLoopBehavior::kWaitForWork : v8::platform::MessageLoopBehavior::kDoNotWait);
 }
 
+void v8__Platform__RunIdleTasks(
+        v8::Platform* platform,
+        v8::Isolate* isolate,
+        double idle_time_in_seconds) {
+    v8::platform::RunIdleTasks(platform, isolate, idle_time_in_seconds);
+}
+
+double v8__Platform__MonotonicallyIncreasingTime(v8::Platform* platform) {
+    return platform->MonotonicallyIncreasingTime();
+}
+
 // Root
 
 const v8::Primitive* v8__Undefined(v8::Isolate* isolate) {
@@ -160,6 +246,18 @@ int v8__V8__Dispose() { return v8::V8::Dispose(); }
 
 void v8__V8__DisposePlatform() { v8::V8::DisposePlatform(); }
 
+void v8__V8__InitializeExternalStartupData(const char* directory_path) {
+    v8::V8::InitializeExternalStartupData(directory_path);
+}
+
+void v8__V8__InitializeExternalStartupDataFromFile(const char* snapshot_blob) {
+    v8::V8::InitializeExternalStartupDataFromFile(snapshot_blob);
+}
+
+void v8__V8__SetSnapshotDataBlob(v8::StartupData* startup_blob) {
+    v8::V8::SetSnapshotDataBlob(startup_blob);
+}
+
 // Isolate
 
 v8::Isolate* v8__Isolate__New(const v8::Isolate::CreateParams& params) {
@@ -211,6 +309,17 @@ void v8__Isolate__PerformMicrotaskCheckpoint(v8::Isolate* self) {
     self->PerformMicrotaskCheckpoint();
 }
 
+void v8__Isolate__EnqueueMicrotask(v8::Isolate* self, const v8::Function* microtask) {
+    self->EnqueueMicrotask(ptr_to_local(microtask));
+}
+
+void v8__Isolate__EnqueueMicrotask__CALLBACK(
+        v8::Isolate* self,
+        v8::MicrotaskCallback callback,
+        void* data) {
+    self->EnqueueMicrotask(callback, data);
+}
+
 bool v8__Isolate__AddMessageListener(
         v8::Isolate* self,
         v8::MessageCallback callback) {
@@ -248,6 +357,26 @@ void v8__Isolate__LowMemoryNotification(v8::Isolate* self) {
     self->LowMemoryNotification();
 }
 
+void v8__Isolate__MemoryPressureNotification(v8::Isolate* self, v8::MemoryPressureLevel level) {
+    self->MemoryPressureNotification(level);
+}
+
+void v8__Isolate__IsolateInBackgroundNotification(v8::Isolate* self) {
+    self->IsolateInBackgroundNotification();
+}
+
+void v8__Isolate__IsolateInForegroundNotification(v8::Isolate* self) {
+    self->IsolateInForegroundNotification();
+}
+
+void v8__Isolate__SetRAILMode(v8::Isolate* self, v8::RAILMode rail_mode) {
+    self->SetRAILMode(rail_mode);
+}
+
+int v8__Isolate__ContextDisposedNotification(v8::Isolate* self, bool dependant_context) {
+    return self->ContextDisposedNotification(dependant_context);
+}
+
 void v8__Isolate__GetHeapStatistics(
         v8::Isolate* self,
         v8::HeapStatistics* stats) {
@@ -273,6 +402,13 @@ v8::BackingStore* v8__ArrayBuffer__NewBackingStore(
     return store.release();
 }
 
+v8::BackingStore* v8__ArrayBuffer__NewResizableBackingStore(
+        size_t byte_len,
+        size_t max_byte_len) {
+    std::unique_ptr<v8::BackingStore> store = v8::ArrayBuffer::NewResizableBackingStore(byte_len, max_byte_len);
+    return store.release();
+}
+
 v8::BackingStore* v8__ArrayBuffer__NewBackingStore2(
         void* data,
         size_t byte_len,
@@ -288,10 +424,23 @@ size_t v8__BackingStore__ByteLength(const v8::BackingStore& self) { return self.
 
 bool v8__BackingStore__IsShared(const v8::BackingStore& self) { return self.IsShared(); }
 
+bool v8__BackingStore__IsResizableByUserJavaScript(const v8::BackingStore& self) { return self.IsResizableByUserJavaScript(); }
+
 SharedPtr v8__BackingStore__TO_SHARED_PTR(v8::BackingStore* unique_ptr) {
     return make_pod<SharedPtr>(std::shared_ptr<v8::BackingStore>(unique_ptr));
 }
 
+void v8__BackingStore__DELETE(v8::BackingStore* self) { delete self; }
+
+v8::BackingStore* v8__BackingStore__Reallocate(
+        v8::Isolate* isolate,
+        v8::BackingStore* unique_ptr,
+        size_t byte_length) {
+    std::unique_ptr<v8::BackingStore> store = v8::BackingStore::Reallocate(
+        isolate, std::unique_ptr<v8::BackingStore>(unique_ptr), byte_length);
+    return store.release();
+}
+
 void std__shared_ptr__v8__BackingStore__reset(std::shared_ptr<v8::BackingStore>* self) { self->reset(); }
 
 v8::BackingStore* std__shared_ptr__v8__BackingStore__get(const std::shared_ptr<v8::BackingStore>& self) { return self.get(); }
@@ -315,12 +464,190 @@ SharedPtr v8__ArrayBuffer__GetBackingStore(const v8::ArrayBuffer& self) {
     return make_pod<SharedPtr>(ptr_to_local(&self)->GetBackingStore());
 }
 
+bool v8__ArrayBuffer__IsDetachable(const v8::ArrayBuffer& self) { return self.IsDetachable(); }
+
+bool v8__ArrayBuffer__WasDetached(const v8::ArrayBuffer& self) { return self.WasDetached(); }
+
+void v8__ArrayBuffer__Detach(
+        const v8::ArrayBuffer& self,
+        const v8::Value* key,
+        v8::Maybe<bool>* out) {
+    *out = ptr_to_local(&self)->Detach(key != nullptr ? ptr_to_local(key) : v8::Local<v8::Value>());
+}
+
+void v8__ArrayBuffer__SetDetachKey(
+        const v8::ArrayBuffer& self,
+        const v8::Value& key) {
+    ptr_to_local(&self)->SetDetachKey(ptr_to_local(&key));
+}
+
+// SharedArrayBuffer
+
+v8::BackingStore* v8__SharedArrayBuffer__NewBackingStore(
+        v8::Isolate* isolate,
+        size_t byte_len) {
+    std::unique_ptr<v8::BackingStore> store = v8::SharedArrayBuffer::NewBackingStore(isolate, byte_len);
+    return store.release();
+}
+
+const v8::SharedArrayBuffer* v8__SharedArrayBuffer__New(
+        v8::Isolate* isolate, size_t byte_len) {
+    return local_to_ptr(v8::SharedArrayBuffer::New(isolate, byte_len));
+}
+
+const v8::SharedArrayBuffer* v8__SharedArrayBuffer__New2(
+        v8::Isolate* isolate,
+        const std::shared_ptr<v8::BackingStore>& backing_store) {
+    return local_to_ptr(v8::SharedArrayBuffer::New(isolate, backing_store));
+}
+
+size_t v8__SharedArrayBuffer__ByteLength(const v8::SharedArrayBuffer& self) { return self.ByteLength(); }
+
+SharedPtr v8__SharedArrayBuffer__GetBackingStore(const v8::SharedArrayBuffer& self) {
+    return make_pod<SharedPtr>(ptr_to_local(&self)->GetBackingStore());
+}
+
+void v8__Isolate__SetAtomicsWaitCallback(
+        v8::Isolate* isolate,
+        v8::Isolate::AtomicsWaitCallback callback,
+        void* data) {
+    isolate->SetAtomicsWaitCallback(callback, data);
+}
+
+void v8__AtomicsWaitWakeHandle__Wake(v8::Isolate::AtomicsWaitWakeHandle* self) {
+    self->Wake();
+}
+
 // ArrayBufferView
 
 const v8::ArrayBuffer* v8__ArrayBufferView__Buffer(const v8::ArrayBufferView& self) {
     return local_to_ptr(ptr_to_local(&self)->Buffer());
 }
 
+size_t v8__ArrayBufferView__ByteOffset(const v8::ArrayBufferView& self) {
+    return ptr_to_local(&self)->ByteOffset();
+}
+
+size_t v8__ArrayBufferView__ByteLength(const v8::ArrayBufferView& self) {
+    return ptr_to_local(&self)->ByteLength();
+}
+
+size_t v8__ArrayBufferView__CopyContents(
+        const v8::ArrayBufferView& self,
+        void* dest,
+        size_t byte_length) {
+    return ptr_to_local(&self)->CopyContents(dest, byte_length);
+}
+
+bool v8__ArrayBufferView__HasBuffer(const v8::ArrayBufferView& self) {
+    return ptr_to_local(&self)->HasBuffer();
+}
+
+// TypedArray
+
+size_t v8__TypedArray__Length(const v8::TypedArray& self) {
+    return ptr_to_local(&self)->Length();
+}
+
+const v8::Int8Array* v8__Int8Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Int8Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::Uint8ClampedArray* v8__Uint8ClampedArray__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Uint8ClampedArray::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::Int16Array* v8__Int16Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Int16Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::Uint16Array* v8__Uint16Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Uint16Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::Int32Array* v8__Int32Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Int32Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::Uint32Array* v8__Uint32Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Uint32Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::Float32Array* v8__Float32Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Float32Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::Float64Array* v8__Float64Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::Float64Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::BigInt64Array* v8__BigInt64Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::BigInt64Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::BigUint64Array* v8__BigUint64Array__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::BigUint64Array::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
+const v8::DataView* v8__DataView__New(
+        const v8::ArrayBuffer& buf,
+        size_t byte_offset,
+        size_t length) {
+    return local_to_ptr(
+        v8::DataView::New(ptr_to_local(&buf), byte_offset, length)
+    );
+}
+
 // HandleScope
 
 void v8__HandleScope__CONSTRUCT(v8::HandleScope* buf, v8::Isolate* isolate) {
@@ -331,6 +658,102 @@ void v8__HandleScope__CONSTRUCT(v8::HandleScope* buf, v8::Isolate* isolate) {
 
 void v8__HandleScope__DESTRUCT(v8::HandleScope* scope) { scope->~HandleScope(); }
 
+size_t v8__HandleScope__SIZEOF() {
+    return sizeof(v8::HandleScope);
+}
+
+// EscapableHandleScope
+
+size_t v8__EscapableHandleScope__SIZEOF() {
+    return sizeof(v8::EscapableHandleScope);
+}
+
+void v8__EscapableHandleScope__CONSTRUCT(v8::EscapableHandleScope* buf, v8::Isolate* isolate) {
+    construct_in_place<v8::EscapableHandleScope>(buf, isolate);
+}
+
+void v8__EscapableHandleScope__DESTRUCT(v8::EscapableHandleScope* scope) { scope->~EscapableHandleScope(); }
+
+const v8::Data* v8__EscapableHandleScope__Escape(
+        v8::EscapableHandleScope* self,
+        const v8::Data& value) {
+    return local_to_ptr(self->Escape(ptr_to_local(&value)));
+}
+
+// SealHandleScope
+
+size_t v8__SealHandleScope__SIZEOF() {
+    return sizeof(v8::SealHandleScope);
+}
+
+void v8__SealHandleScope__CONSTRUCT(v8::SealHandleScope* buf, v8::Isolate* isolate) {
+    construct_in_place<v8::SealHandleScope>(buf, isolate);
+}
+
+void v8__SealHandleScope__DESTRUCT(v8::SealHandleScope* scope) { scope->~SealHandleScope(); }
+
+// MicrotaskQueue
+
+v8::MicrotaskQueue* v8__MicrotaskQueue__New(v8::Isolate* isolate, v8::MicrotasksPolicy policy) {
+    return v8::MicrotaskQueue::New(isolate, policy).release();
+}
+
+void v8__MicrotaskQueue__DELETE(v8::MicrotaskQueue* self) { delete self; }
+
+void v8__MicrotaskQueue__EnqueueMicrotask(
+        v8::MicrotaskQueue* self,
+        v8::Isolate* isolate,
+        const v8::Function* microtask) {
+    self->EnqueueMicrotask(isolate, ptr_to_local(microtask));
+}
+
+void v8__MicrotaskQueue__EnqueueMicrotask__CALLBACK(
+        v8::MicrotaskQueue* self,
+        v8::Isolate* isolate,
+        v8::MicrotaskCallback callback,
+        void* data) {
+    self->EnqueueMicrotask(isolate, callback, data);
+}
+
+void v8__MicrotaskQueue__PerformCheckpoint(v8::MicrotaskQueue* self, v8::Isolate* isolate) {
+    self->PerformCheckpoint(isolate);
+}
+
+bool v8__MicrotaskQueue__IsRunningMicrotasks(const v8::MicrotaskQueue& self) {
+    return self.IsRunningMicrotasks();
+}
+
+int v8__MicrotaskQueue__GetMicrotasksScopeDepth(const v8::MicrotaskQueue& self) {
+    return self.GetMicrotasksScopeDepth();
+}
+
+// MicrotasksScope
+
+size_t v8__MicrotasksScope__SIZEOF() {
+    return sizeof(v8::MicrotasksScope);
+}
+
+void v8__MicrotasksScope__CONSTRUCT(
+        v8::MicrotasksScope* buf,
+        const v8::Context& context,
+        v8::MicrotasksScope::Type type) {
+    construct_in_place<v8::MicrotasksScope>(buf, ptr_to_local(&context), type);
+}
+
+void v8__MicrotasksScope__DESTRUCT(v8::MicrotasksScope* self) { self->~MicrotasksScope(); }
+
+void v8__MicrotasksScope__PerformCheckpoint(v8::Isolate* isolate) {
+    v8::MicrotasksScope::PerformCheckpoint(isolate);
+}
+
+int v8__MicrotasksScope__GetCurrentDepth(v8::Isolate* isolate) {
+    return v8::MicrotasksScope::GetCurrentDepth(isolate);
+}
+
+bool v8__MicrotasksScope__IsRunningMicrotasks(v8::Isolate* isolate) {
+    return v8::MicrotasksScope::IsRunningMicrotasks(isolate);
+}
+
 // Context
 
 v8::Context* v8__Context__New(
@@ -342,6 +765,64 @@ v8::Context* v8__Context__New(
     );
 }
 
+v8::Context* v8__Context__New__QUEUE(
+        v8::Isolate* isolate,
+        const v8::ObjectTemplate* global_tmpl,
+        const v8::Value* global_obj,
+        v8::MicrotaskQueue* queue) {
+    return local_to_ptr(
+        v8::Context::New(isolate, nullptr, ptr_to_maybe_local(global_tmpl), ptr_to_maybe_local(global_obj),
+            v8::DeserializeInternalFieldsCallback(), queue)
+    );
+}
+
+v8::MicrotaskQueue* v8__Context__GetMicrotaskQueue(const v8::Context& self) {
+    return ptr_to_local(&self)->GetMicrotaskQueue();
+}
+
+const v8::Context* v8__Context__FromSnapshot(
+        v8::Isolate* isolate,
+        size_t context_snapshot_index,
+        v8::MicrotaskQueue* queue) {
+    return maybe_local_to_ptr(v8::Context::FromSnapshot(
+        isolate, context_snapshot_index, v8::DeserializeInternalFieldsCallback(), nullptr, v8::MaybeLocal<v8::Value>(), queue
+    ));
+}
+
+// SnapshotCreator
+
+v8::SnapshotCreator* v8__SnapshotCreator__NEW(
+        const intptr_t* external_references,
+        const v8::StartupData* existing_blob) {
+    return new v8::SnapshotCreator(external_references, const_cast<v8::StartupData*>(existing_blob));
+}
+
+void v8__SnapshotCreator__DELETE(v8::SnapshotCreator* self) { delete self; }
+
+v8::Isolate* v8__SnapshotCreator__GetIsolate(v8::SnapshotCreator* self) {
+    return self->GetIsolate();
+}
+
+void v8__SnapshotCreator__SetDefaultContext(v8::SnapshotCreator* self, const v8::Context& context) {
+    self->SetDefaultContext(ptr_to_local(&context));
+}
+
+size_t v8__SnapshotCreator__AddContext(v8::SnapshotCreator* self, const v8::Context& context) {
+    return self->AddContext(ptr_to_local(&context));
+}
+
+v8::StartupData v8__SnapshotCreator__CreateBlob(
+        v8::SnapshotCreator* self,
+        v8::SnapshotCreator::FunctionCodeHandling function_code_handling) {
+    return self->CreateBlob(function_code_handling);
+}
+
+void v8__StartupData__DeleteData(v8::StartupData* self) {
+    delete[] self->data;
+    self->data = nullptr;
+    self->raw_size = 0;
+}
+
 void v8__Context__Enter(const v8::Context& context) { ptr_to_local(&context)->Enter(); }
 
 void v8__Context__Exit(const v8::Context& context) { ptr_to_local(&context)->Exit(); }
@@ -414,6 +895,16 @@ v8::Value* v8__Script__Run(
     return maybe_local_to_ptr(ptr_to_local(&script)->Run(ptr_to_local(&context)));
 }
 
+const v8::UnboundScript* v8__Script__GetUnboundScript(const v8::Script& script) {
+    return local_to_ptr(ptr_to_local(&script)->GetUnboundScript());
+}
+
+// UnboundScript
+
+const v8::Script* v8__UnboundScript__BindToCurrentContext(const v8::UnboundScript& self) {
+    return local_to_ptr(ptr_to_local(&self)->BindToCurrentContext());
+}
+
 // ScriptCompiler
 
 size_t v8__ScriptCompiler__Source__SIZEOF() {
@@ -439,6 +930,11 @@ void v8__ScriptCompiler__Source__DESTRUCT(v8::ScriptCompiler::Source* self) {
     self->~Source();
 }
 
+const v8::ScriptCompiler::CachedData* v8__ScriptCompiler__Source__GetCachedData(
+        const v8::ScriptCompiler::Source* self) {
+    return self->GetCachedData();
+}
+
 size_t v8__ScriptCompiler__CachedData__SIZEOF() {
     return sizeof(v8::ScriptCompiler::CachedData);
 }
@@ -464,6 +960,53 @@ const v8::Module* v8__ScriptCompiler__CompileModule(
     return maybe_local_to_ptr(maybe_local);
 }
 
+const v8::Script* v8__ScriptCompiler__Compile(
+        const v8::Context& context,
+        v8::ScriptCompiler::Source* source,
+        v8::ScriptCompiler::CompileOptions options,
+        v8::ScriptCompiler::NoCacheReason reason) {
+    return maybe_local_to_ptr(v8::ScriptCompiler::Compile(ptr_to_local(&context), source, options, reason));
+}
+
+const v8::UnboundScript* v8__ScriptCompiler__CompileUnboundScript(
+        v8::Isolate* isolate,
+        v8::ScriptCompiler::Source* source,
+        v8::ScriptCompiler::CompileOptions options,
+        v8::ScriptCompiler::NoCacheReason reason) {
+    return maybe_local_to_ptr(v8::ScriptCompiler::CompileUnboundScript(isolate, source, options, reason));
+}
+
+v8::ScriptCompiler::CachedData* v8__ScriptCompiler__CreateCodeCache(
+        const v8::UnboundScript& unbound_script) {
+    return v8::ScriptCompiler::CreateCodeCache(ptr_to_local(&unbound_script));
+}
+
+const v8::Function* v8__ScriptCompiler__CompileFunction(
+        const v8::Context& context,
+        v8::ScriptCompiler::Source* source,
+        size_t arguments_count,
+        const v8::String* const arguments[],
+        size_t context_extensions_count,
+        const v8::Object* const context_extensions[],
+        v8::ScriptCompiler::CompileOptions options,
+        v8::ScriptCompiler::NoCacheReason reason) {
+    return maybe_local_to_ptr(v8::ScriptCompiler::CompileFunction(
+        ptr_to_local(&context),
+        source,
+        arguments_count,
+        const_ptr_array_to_local_array(arguments),
+        context_extensions_count,
+        const_ptr_array_to_local_array(context_extensions),
+        options,
+        reason
+    ));
+}
+
+v8::ScriptCompiler::CachedData* v8__ScriptCompiler__CreateCodeCacheForFunction(
+        const v8::Function& function) {
+    return v8::ScriptCompiler::CreateCodeCacheForFunction(ptr_to_local(&function));
+}
+
 // Module
 
 v8::Module::Status v8__Module__GetStatus(const v8::Module& self) {
@@ -739,10 +1282,36 @@ bool v8__Value__IsArray(const v8::Value& self) { return self.IsArray(); }
 
 bool v8__Value__IsArrayBuffer(const v8::Value& self) { return self.IsArrayBuffer(); }
 
+bool v8__Value__IsSharedArrayBuffer(const v8::Value& self) { return self.IsSharedArrayBuffer(); }
+
 bool v8__Value__IsArrayBufferView(const v8::Value& self) { return self.IsArrayBufferView(); }
 
+bool v8__Value__IsTypedArray(const v8::Value& self) { return self.IsTypedArray(); }
+
+bool v8__Value__IsInt8Array(const v8::Value& self) { return self.IsInt8Array(); }
+
 bool v8__Value__IsUint8Array(const v8::Value& self) { return self.IsUint8Array(); }
 
+bool v8__Value__IsUint8ClampedArray(const v8::Value& self) { return self.IsUint8ClampedArray(); }
+
+bool v8__Value__IsInt16Array(const v8::Value& self) { return self.IsInt16Array(); }
+
+bool v8__Value__IsUint16Array(const v8::Value& self) { return self.IsUint16Array(); }
+
+bool v8__Value__IsInt32Array(const v8::Value& self) { return self.IsInt32Array(); }
+
+bool v8__Value__IsUint32Array(const v8::Value& self) { return self.IsUint32Array(); }
+
+bool v8__Value__IsFloat32Array(const v8::Value& self) { return self.IsFloat32Array(); }
+
+bool v8__Value__IsFloat64Array(const v8::Value& self) { return self.IsFloat64Array(); }
+
+bool v8__Value__IsBigInt64Array(const v8::Value& self) { return self.IsBigInt64Array(); }
+
+bool v8__Value__IsBigUint64Array(const v8::Value& self) { return self.IsBigUint64Array(); }
+
+bool v8__Value__IsDataView(const v8::Value& self) { return self.IsDataView(); }
+
 bool v8__Value__IsExternal(const v8::Value& self) { return self.IsExternal(); }
 
 bool v8__Value__IsTrue(const v8::Value& self) { return self.IsTrue(); }
@@ -765,6 +1334,8 @@ bool v8__Value__IsBigIntObject(const v8::Value& self) {
     return self.IsBigIntObject();
 }
 
+bool v8__Value__IsWasmModuleObject(const v8::Value& self) { return self.IsWasmModuleObject(); }
+
 void v8__Value__InstanceOf(
         const v8::Value& self,
         const v8::Context& ctx,
@@ -822,12 +1393,106 @@ void v8__ObjectTemplate__SetAccessor__DEFAULT(
     ptr_to_local(&self)->SetAccessor(ptr_to_local(&key), getter);
 }
 
-void v8__ObjectTemplate__SetAccessor__DEFAULT2(
-        const v8::ObjectTemplate& self,
-        const v8::Name& key,
-        v8::AccessorNameGetterCallback getter,
-        v8::AccessorNameSetterCallback setter) {
-    ptr_to_local(&self)->SetAccessor(ptr_to_local(&key), getter, setter);
+void v8__ObjectTemplate__SetAccessor__DEFAULT2(
+        const v8::ObjectTemplate& self,
+        const v8::Name& key,
+        v8::AccessorNameGetterCallback getter,
+        v8::AccessorNameSetterCallback setter) {
+    ptr_to_local(&self)->SetAccessor(ptr_to_local(&key), getter, setter);
+}
+
+struct NamedPropertyHandlerConfiguration {
+    v8::GenericNamedPropertyGetterCallback getter;
+    v8::GenericNamedPropertySetterCallback setter;
+    v8::GenericNamedPropertyQueryCallback query;
+    v8::GenericNamedPropertyDeleterCallback deleter;
+    v8::GenericNamedPropertyEnumeratorCallback enumerator;
+    v8::GenericNamedPropertyDefinerCallback definer;
+    v8::GenericNamedPropertyDescriptorCallback descriptor;
+    const v8::Value* data;
+    v8::PropertyHandlerFlags flags;
+};
+
+struct IndexedPropertyHandlerConfiguration {
+    v8::IndexedPropertyGetterCallback getter;
+    v8::IndexedPropertySetterCallback setter;
+    v8::IndexedPropertyQueryCallback query;
+    v8::IndexedPropertyDeleterCallback deleter;
+    v8::IndexedPropertyEnumeratorCallback enumerator;
+    v8::IndexedPropertyDefinerCallback definer;
+    v8::IndexedPropertyDescriptorCallback descriptor;
+    const v8::Value* data;
+    v8::PropertyHandlerFlags flags;
+};
+
+void v8__ObjectTemplate__SetNamedHandler(
+        const v8::ObjectTemplate& self,
+        const NamedPropertyHandlerConfiguration& config) {
+    ptr_to_local(&self)->SetHandler(v8::NamedPropertyHandlerConfiguration(
+        config.getter, config.setter, config.query, config.deleter,
+        config.enumerator, config.definer, config.descriptor,
+        ptr_to_local(config.data), config.flags
+    ));
+}
+
+void v8__ObjectTemplate__SetIndexedHandler(
+        const v8::ObjectTemplate& self,
+        const IndexedPropertyHandlerConfiguration& config) {
+    ptr_to_local(&self)->SetHandler(v8::IndexedPropertyHandlerConfiguration(
+        config.getter, config.setter, config.query, config.deleter,
+        config.enumerator, config.definer, config.descriptor,
+        ptr_to_local(config.data), config.flags
+    ));
+}
+
+// PropertyDescriptor
+
+bool v8__PropertyDescriptor__has_value(const v8::PropertyDescriptor& self) {
+    return self.has_value();
+}
+
+const v8::Value* v8__PropertyDescriptor__value(const v8::PropertyDescriptor& self) {
+    return local_to_ptr(self.value());
+}
+
+bool v8__PropertyDescriptor__has_get(const v8::PropertyDescriptor& self) {
+    return self.has_get();
+}
+
+const v8::Value* v8__PropertyDescriptor__get(const v8::PropertyDescriptor& self) {
+    return local_to_ptr(self.get());
+}
+
+bool v8__PropertyDescriptor__has_set(const v8::PropertyDescriptor& self) {
+    return self.has_set();
+}
+
+const v8::Value* v8__PropertyDescriptor__set(const v8::PropertyDescriptor& self) {
+    return local_to_ptr(self.set());
+}
+
+bool v8__PropertyDescriptor__has_enumerable(const v8::PropertyDescriptor& self) {
+    return self.has_enumerable();
+}
+
+bool v8__PropertyDescriptor__enumerable(const v8::PropertyDescriptor& self) {
+    return self.enumerable();
+}
+
+bool v8__PropertyDescriptor__has_configurable(const v8::PropertyDescriptor& self) {
+    return self.has_configurable();
+}
+
+bool v8__PropertyDescriptor__configurable(const v8::PropertyDescriptor& self) {
+    return self.configurable();
+}
+
+bool v8__PropertyDescriptor__has_writable(const v8::PropertyDescriptor& self) {
+    return self.has_writable();
+}
+
+bool v8__PropertyDescriptor__writable(const v8::PropertyDescriptor& self) {
+    return self.writable();
 }
 
 // Array
@@ -849,6 +1514,81 @@ const v8::Array* v8__Array__New2(
 
 uint32_t v8__Array__Length(const v8::Array& self) { return self.Length(); }
 
+const v8::Array* v8__Array__New__F64(
+        v8::Isolate* isolate,
+        const double* elements,
+        size_t length) {
+    return new_array_from(isolate, elements, length, [](v8::Isolate* isolate, double value) {
+        return v8::Number::New(isolate, value);
+    });
+}
+
+const v8::Array* v8__Array__New__I32(
+        v8::Isolate* isolate,
+        const int32_t* elements,
+        size_t length) {
+    return new_array_from(isolate, elements, length, [](v8::Isolate* isolate, int32_t value) {
+        return v8::Integer::New(isolate, value);
+    });
+}
+
+const v8::Array* v8__Array__New__U32(
+        v8::Isolate* isolate,
+        const uint32_t* elements,
+        size_t length) {
+    return new_array_from(isolate, elements, length, [](v8::Isolate* isolate, uint32_t value) {
+        return v8::Integer::NewFromUnsigned(isolate, value);
+    });
+}
+
+// Element handles are created in the caller's HandleScope so they stay valid after this returns.
+bool v8__Array__CopyTo__VALUES(
+        const v8::Array& self,
+        const v8::Context& ctx,
+        const v8::Value** out,
+        size_t length,
+        size_t* out_copied) {
+    auto array = ptr_to_local(&self);
+    auto context = ptr_to_local(&ctx);
+    size_t n = std::min(length, (size_t)array->Length());
+    *out_copied = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        v8::Local<v8::Value> element;
+        if (!array->Get(context, i).ToLocal(&element)) {
+            return false;
+        }
+        out[i] = local_to_ptr(element);
+        *out_copied += 1;
+    }
+    return true;
+}
+
+// Stops at the first element that isn't a number instead of coercing it, since ToNumber could call into JS.
+bool v8__Array__CopyTo__F64(
+        const v8::Array& self,
+        const v8::Context& ctx,
+        double* out,
+        size_t length,
+        size_t* out_copied) {
+    auto array = ptr_to_local(&self);
+    auto context = ptr_to_local(&ctx);
+    v8::HandleScope scope(context->GetIsolate());
+    size_t n = std::min(length, (size_t)array->Length());
+    *out_copied = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        v8::Local<v8::Value> element;
+        if (!array->Get(context, i).ToLocal(&element)) {
+            return false;
+        }
+        if (!element->IsNumber()) {
+            break;
+        }
+        out[i] = element.As<v8::Number>()->Value();
+        *out_copied += 1;
+    }
+    return true;
+}
+
 // Object
 
 const v8::Object* v8__Object__New(
@@ -856,6 +1596,21 @@ const v8::Object* v8__Object__New(
     return local_to_ptr(v8::Object::New(isolate));
 }
 
+const v8::Object* v8__Object__New2(
+        v8::Isolate* isolate,
+        const v8::Value& prototype,
+        const v8::Name* const names[],
+        const v8::Value* const values[],
+        size_t length) {
+    return local_to_ptr(v8::Object::New(
+        isolate,
+        ptr_to_local(&prototype),
+        const_ptr_array_to_local_array(names),
+        const_ptr_array_to_local_array(values),
+        length
+    ));
+}
+
 void v8__Object__SetInternalField(
         const v8::Object& self,
         int index,
@@ -900,6 +1655,42 @@ void v8__Object__Set(
     );
 }
 
+// Stops at the first key that throws.
+bool v8__Object__Get__BATCH(
+        const v8::Object& self,
+        const v8::Context& ctx,
+        const v8::Value* const keys[],
+        const v8::Value** out_values,
+        size_t length) {
+    auto obj = ptr_to_local(&self);
+    auto context = ptr_to_local(&ctx);
+    for (size_t i = 0; i < length; i++) {
+        v8::Local<v8::Value> value;
+        if (!obj->Get(context, ptr_to_local(keys[i])).ToLocal(&value)) {
+            return false;
+        }
+        out_values[i] = local_to_ptr(value);
+    }
+    return true;
+}
+
+// Stops at the first key that throws.
+bool v8__Object__Set__BATCH(
+        const v8::Object& self,
+        const v8::Context& ctx,
+        const v8::Value* const keys[],
+        const v8::Value* const values[],
+        size_t length) {
+    auto obj = ptr_to_local(&self);
+    auto context = ptr_to_local(&ctx);
+    for (size_t i = 0; i < length; i++) {
+        if (obj->Set(context, ptr_to_local(keys[i]), ptr_to_local(values[i])).IsNothing()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void v8__Object__DefineOwnProperty(
         const v8::Object& self,
         const v8::Context& ctx,
@@ -927,6 +1718,10 @@ int v8__Object__GetIdentityHash(const v8::Object& self) {
     return ptr_to_local(&self)->GetIdentityHash();
 }
 
+const v8::Value* v8__Object__GetPrototype(const v8::Object& self) {
+    return local_to_ptr(ptr_to_local(&self)->GetPrototype());
+}
+
 void v8__Object__Has(
         const v8::Object& self,
         const v8::Context& ctx,
@@ -968,6 +1763,12 @@ void v8__Object__SetAlignedPointerInInternalField(
     ptr_to_local(self)->SetAlignedPointerInInternalField(idx, ptr);
 }
 
+void* v8__Object__GetAlignedPointerFromInternalField(
+        const v8::Object& self,
+        int idx) {
+    return ptr_to_local(&self)->GetAlignedPointerFromInternalField(idx);
+}
+
 // FunctionCallbackInfo
 
 v8::Isolate* v8__FunctionCallbackInfo__GetIsolate(
@@ -1020,6 +1821,11 @@ const v8::Object* v8__PropertyCallbackInfo__This(
     return local_to_ptr(self.This());
 }
 
+const v8::Object* v8__PropertyCallbackInfo__Holder(
+        const v8::PropertyCallbackInfo<v8::Value>& self) {
+    return local_to_ptr(self.Holder());
+}
+
 const v8::Value* v8__PropertyCallbackInfo__Data(
         const v8::PropertyCallbackInfo<v8::Value>& self) {
     return local_to_ptr(self.Data());
@@ -1056,6 +1862,45 @@ const v8::Value* v8__ReturnValue__Get(
     return local_to_ptr(self.Get());
 }
 
+void v8__ReturnValue__SetInt32(
+        v8::ReturnValue<v8::Value> self,
+        int32_t value) {
+    self.Set(value);
+}
+
+void v8__ReturnValue__SetUint32(
+        v8::ReturnValue<v8::Value> self,
+        uint32_t value) {
+    self.Set(value);
+}
+
+void v8__ReturnValue__SetDouble(
+        v8::ReturnValue<v8::Value> self,
+        double value) {
+    self.Set(value);
+}
+
+void v8__ReturnValue__SetBool(
+        v8::ReturnValue<v8::Value> self,
+        bool value) {
+    self.Set(value);
+}
+
+void v8__ReturnValue__SetNull(
+        v8::ReturnValue<v8::Value> self) {
+    self.SetNull();
+}
+
+void v8__ReturnValue__SetUndefined(
+        v8::ReturnValue<v8::Value> self) {
+    self.SetUndefined();
+}
+
+void v8__ReturnValue__SetEmptyString(
+        v8::ReturnValue<v8::Value> self) {
+    self.SetEmptyString();
+}
+
 // FunctionTemplate
 
 const v8::FunctionTemplate* v8__FunctionTemplate__New__DEFAULT(
@@ -1076,6 +1921,20 @@ const v8::FunctionTemplate* v8__FunctionTemplate__New__DEFAULT3(
     return local_to_ptr(v8::FunctionTemplate::New(isolate, callback_or_null, ptr_to_local(&data)));
 }
 
+const v8::Signature* v8__Signature__New(
+        v8::Isolate* isolate,
+        const v8::FunctionTemplate* receiver) {
+    return local_to_ptr(v8::Signature::New(isolate, ptr_to_local(receiver)));
+}
+
+const v8::FunctionTemplate* v8__FunctionTemplate__New__DEFAULT4(
+        v8::Isolate* isolate,
+        v8::FunctionCallback callback_or_null,
+        const v8::Value* data_or_null,
+        const v8::Signature* signature) {
+    return local_to_ptr(v8::FunctionTemplate::New(isolate, callback_or_null, ptr_to_local(data_or_null), ptr_to_local(signature)));
+}
+
 const v8::ObjectTemplate* v8__FunctionTemplate__InstanceTemplate(
         const v8::FunctionTemplate& self) {
     return local_to_ptr(ptr_to_local(&self)->InstanceTemplate());
@@ -1200,6 +2059,188 @@ void v8__Persistent__SetWeakFinalizer(
     self->SetWeak(finalizer_ctx, finalizer_cb, type);
 }
 
+// Global
+
+size_t v8__Global__SIZEOF() {
+    return sizeof(v8::Global<v8::Data>);
+}
+
+void v8__Global__New(
+        v8::Isolate* isolate,
+        const v8::Data& data,
+        v8::Global<v8::Data>* out) {
+    new (out) v8::Global<v8::Data>(isolate, ptr_to_local(&data));
+}
+
+void v8__Global__Reset(v8::Global<v8::Data>* self) {
+    self->Reset();
+}
+
+// Moving lets V8 update any reference it keeps to the handle's location, eg. for SetWeak without a parameter.
+// Move assignment resets the handle already in out before taking over self's.
+void v8__Global__MOVE(
+        v8::Global<v8::Data>* self,
+        v8::Global<v8::Data>* out) {
+    *out = std::move(*self);
+}
+
+// Same as MOVE, but out is uninitialized memory.
+void v8__Global__MOVE_CONSTRUCT(
+        v8::Global<v8::Data>* self,
+        v8::Global<v8::Data>* out) {
+    new (out) v8::Global<v8::Data>(std::move(*self));
+}
+
+void v8__Global__Reset__BATCH(
+        v8::Global<v8::Data>* handles,
+        size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        handles[i].Reset();
+    }
+}
+
+// TracedReference
+
+size_t v8__TracedReference__SIZEOF() {
+    return sizeof(v8::TracedReference<v8::Value>);
+}
+
+void v8__TracedReference__CONSTRUCT(v8::TracedReference<v8::Value>* buf) {
+    new (buf) v8::TracedReference<v8::Value>();
+}
+
+void v8__TracedReference__DESTRUCT(v8::TracedReference<v8::Value>* self) {
+    self->~TracedReference();
+}
+
+void v8__TracedReference__Reset(
+        v8::TracedReference<v8::Value>* self,
+        v8::Isolate* isolate,
+        const v8::Value& value) {
+    self->Reset(isolate, ptr_to_local(&value));
+}
+
+void v8__TracedReference__Reset__EMPTY(v8::TracedReference<v8::Value>* self) {
+    self->Reset();
+}
+
+const v8::Value* v8__TracedReference__Get(
+        const v8::TracedReference<v8::Value>& self,
+        v8::Isolate* isolate) {
+    return local_to_ptr(self.Get(isolate));
+}
+
+bool v8__TracedReference__IsEmpty(const v8::TracedReference<v8::Value>& self) {
+    return self.IsEmpty();
+}
+
+// CppHeap
+
+void v8__cppgc__InitializeProcess(v8::Platform* platform) {
+    cppgc::InitializeProcess(platform->GetPageAllocator());
+}
+
+void v8__cppgc__ShutdownProcess() {
+    cppgc::ShutdownProcess();
+}
+
+v8::CppHeap* v8__CppHeap__Create(
+        v8::Platform* platform,
+        int wrappable_type_index,
+        int wrappable_instance_index,
+        uint16_t embedder_id) {
+    v8::CppHeapCreateParams params{
+        {},
+        v8::WrapperDescriptor(wrappable_type_index, wrappable_instance_index, embedder_id),
+    };
+    std::unique_ptr<v8::CppHeap> heap = v8::CppHeap::Create(platform, params);
+    return heap.release();
+}
+
+void v8__CppHeap__Terminate(v8::CppHeap* self) { self->Terminate(); }
+
+void v8__CppHeap__DELETE(v8::CppHeap* self) { delete self; }
+
+void v8__Isolate__AttachCppHeap(v8::Isolate* isolate, v8::CppHeap* heap) {
+    isolate->AttachCppHeap(heap);
+}
+
+void v8__Isolate__DetachCppHeap(v8::Isolate* isolate) {
+    isolate->DetachCppHeap();
+}
+
+v8::CppHeap* v8__Isolate__GetCppHeap(const v8::Isolate* isolate) {
+    return isolate->GetCppHeap();
+}
+
+GcObject* v8__cppgc__MakeGarbageCollected(
+        v8::CppHeap* heap,
+        size_t size,
+        const GcObjectVtable* vtable,
+        GcObjectInit init,
+        const void* init_data) {
+    return cppgc::MakeGarbageCollected<GcObject>(
+        heap->GetAllocationHandle(), cppgc::AdditionalBytes(size), vtable, size, init, init_data);
+}
+
+void* v8__GcObject__Data(const GcObject& self) {
+    return self.Data();
+}
+
+GcObject* v8__GcObject__FromData(const void* data) {
+    return const_cast<GcObject*>(static_cast<const GcObject*>(data) - 1);
+}
+
+size_t v8__GcMember__SIZEOF() {
+    return sizeof(cppgc::Member<GcObject>);
+}
+
+void v8__GcMember__CONSTRUCT(cppgc::Member<GcObject>* buf) {
+    new (buf) cppgc::Member<GcObject>();
+}
+
+// Assignment goes through cppgc's write barrier, which keeps incremental marking correct.
+void v8__GcMember__Set(
+        cppgc::Member<GcObject>* self,
+        const GcObject* value) {
+    *self = const_cast<GcObject*>(value);
+}
+
+const GcObject* v8__GcMember__Get(const cppgc::Member<GcObject>& self) {
+    return self.Get();
+}
+
+void v8__CppgcVisitor__TraceMember(
+        cppgc::Visitor* self,
+        const cppgc::Member<GcObject>& member) {
+    self->Trace(member);
+}
+
+void v8__CppgcVisitor__TraceReference(
+        cppgc::Visitor* self,
+        const v8::TracedReference<v8::Value>& ref) {
+    self->Trace(ref);
+}
+
+// Eternal
+
+size_t v8__Eternal__SIZEOF() {
+    return sizeof(v8::Eternal<v8::Data>);
+}
+
+void v8__Eternal__New(
+        v8::Isolate* isolate,
+        const v8::Data& data,
+        v8::Eternal<v8::Data>* out) {
+    new (out) v8::Eternal<v8::Data>(isolate, ptr_to_local(&data));
+}
+
+const v8::Data* v8__Eternal__Get(
+        const v8::Eternal<v8::Data>& self,
+        v8::Isolate* isolate) {
+    return local_to_ptr(self.Get(isolate));
+}
+
 // WeakCallbackInfo
 
 v8::Isolate* v8__WeakCallbackInfo__GetIsolate(
@@ -1371,6 +2412,246 @@ bool v8__StackFrame__IsWasm(const v8::StackFrame& self) { return self.IsWasm();
 
 bool v8__StackFrame__IsUserJavaScript(const v8::StackFrame& self) { return self.IsUserJavaScript(); }
 
+// OwnedBuffer
+
+struct OwnedBuffer {
+    const uint8_t* data;
+    size_t size;
+};
+
+void v8__OwnedBuffer__DELETE(OwnedBuffer* self) {
+    delete[] self->data;
+    self->data = nullptr;
+    self->size = 0;
+}
+
+// WasmStreaming callback
+
+void v8__Isolate__SetWasmStreamingCallback(
+        v8::Isolate* isolate,
+        v8::WasmStreamingCallback callback) {
+    isolate->SetWasmStreamingCallback(callback);
+}
+
+#if V8_ENABLE_WEBASSEMBLY
+
+// WasmModuleObject
+
+const v8::WasmModuleObject* v8__WasmModuleObject__Compile(
+        v8::Isolate* isolate,
+        const uint8_t* wire_bytes,
+        size_t wire_bytes_len) {
+    return maybe_local_to_ptr(
+        v8::WasmModuleObject::Compile(isolate, v8::MemorySpan<const uint8_t>(wire_bytes, wire_bytes_len))
+    );
+}
+
+const v8::WasmModuleObject* v8__WasmModuleObject__DeserializeOrCompile(
+        v8::Isolate* isolate,
+        const uint8_t* serialized_module,
+        size_t serialized_module_len,
+        const uint8_t* wire_bytes,
+        size_t wire_bytes_len) {
+    // WasmModuleObject::DeserializeOrCompile is no longer part of the public api.
+    // Deserialize through the internal serializer the same way api.cc used to.
+    v8::internal::Isolate* i_isolate = reinterpret_cast<v8::internal::Isolate*>(isolate);
+    v8::internal::Handle<v8::internal::WasmModuleObject> module_object;
+    if (v8::internal::wasm::DeserializeNativeModule(
+            i_isolate,
+            {serialized_module, serialized_module_len},
+            {wire_bytes, wire_bytes_len},
+            {}).ToHandle(&module_object)) {
+        return local_to_ptr(v8::Local<v8::WasmModuleObject>::Cast(
+            v8::Utils::ToLocal(v8::internal::Handle<v8::internal::JSObject>::cast(module_object))
+        ));
+    }
+    // The cached machine code was rejected (eg. different v8 version or flags), compile from the wire bytes instead.
+    return v8__WasmModuleObject__Compile(isolate, wire_bytes, wire_bytes_len);
+}
+
+const v8::WasmModuleObject* v8__WasmModuleObject__FromCompiledModule(
+        v8::Isolate* isolate,
+        const v8::CompiledWasmModule& compiled_module) {
+    return maybe_local_to_ptr(
+        v8::WasmModuleObject::FromCompiledModule(isolate, compiled_module)
+    );
+}
+
+v8::CompiledWasmModule* v8__WasmModuleObject__GetCompiledModule(
+        const v8::WasmModuleObject& self) {
+    return new v8::CompiledWasmModule(ptr_to_local(&self)->GetCompiledModule());
+}
+
+// CompiledWasmModule
+
+void v8__CompiledWasmModule__DELETE(v8::CompiledWasmModule* self) { delete self; }
+
+void v8__CompiledWasmModule__Serialize(
+        v8::CompiledWasmModule* self,
+        OwnedBuffer* out) {
+    v8::OwnedBuffer buf = self->Serialize();
+    out->size = buf.size;
+    out->data = buf.buffer.release();
+}
+
+const uint8_t* v8__CompiledWasmModule__GetWireBytesRef(
+        v8::CompiledWasmModule* self,
+        size_t* length) {
+    v8::MemorySpan<const uint8_t> span = self->GetWireBytesRef();
+    *length = span.size();
+    return span.data();
+}
+
+const char* v8__CompiledWasmModule__SourceUrl(
+        const v8::CompiledWasmModule& self,
+        size_t* length) {
+    const std::string& url = self.source_url();
+    *length = url.size();
+    return url.data();
+}
+
+// WasmStreaming
+
+SharedPtr v8__WasmStreaming__Unpack(
+        v8::Isolate* isolate,
+        const v8::Value& value) {
+    return make_pod<SharedPtr>(v8::WasmStreaming::Unpack(isolate, ptr_to_local(&value)));
+}
+
+void std__shared_ptr__v8__WasmStreaming__reset(std::shared_ptr<v8::WasmStreaming>* self) { self->reset(); }
+
+void v8__WasmStreaming__OnBytesReceived(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const uint8_t* bytes,
+        size_t size) {
+    self->OnBytesReceived(bytes, size);
+}
+
+void v8__WasmStreaming__Finish(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        bool can_use_compiled_module) {
+    self->Finish(can_use_compiled_module);
+}
+
+void v8__WasmStreaming__Abort(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const v8::Value* exception) {
+    self->Abort(ptr_to_maybe_local(exception));
+}
+
+bool v8__WasmStreaming__SetCompiledModuleBytes(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const uint8_t* bytes,
+        size_t size) {
+    return self->SetCompiledModuleBytes(bytes, size);
+}
+
+void v8__WasmStreaming__SetUrl(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const char* url,
+        size_t length) {
+    self->SetUrl(url, length);
+}
+
+#else
+
+// WasmModuleObject, CompiledWasmModule and WasmStreaming are compiled out with v8_enable_webassembly=false.
+// The stubs keep the C API linkable, calling any of them is a bug in the embedder.
+
+#define WASM_DISABLED() FATAL("%s: WebAssembly is disabled in this V8 build", __func__)
+
+const v8::WasmModuleObject* v8__WasmModuleObject__Compile(
+        v8::Isolate* isolate,
+        const uint8_t* wire_bytes,
+        size_t wire_bytes_len) {
+    WASM_DISABLED();
+}
+
+const v8::WasmModuleObject* v8__WasmModuleObject__DeserializeOrCompile(
+        v8::Isolate* isolate,
+        const uint8_t* serialized_module,
+        size_t serialized_module_len,
+        const uint8_t* wire_bytes,
+        size_t wire_bytes_len) {
+    WASM_DISABLED();
+}
+
+const v8::WasmModuleObject* v8__WasmModuleObject__FromCompiledModule(
+        v8::Isolate* isolate,
+        const v8::CompiledWasmModule& compiled_module) {
+    WASM_DISABLED();
+}
+
+v8::CompiledWasmModule* v8__WasmModuleObject__GetCompiledModule(
+        const v8::WasmModuleObject& self) {
+    WASM_DISABLED();
+}
+
+void v8__CompiledWasmModule__DELETE(v8::CompiledWasmModule* self) { WASM_DISABLED(); }
+
+void v8__CompiledWasmModule__Serialize(
+        v8::CompiledWasmModule* self,
+        OwnedBuffer* out) {
+    WASM_DISABLED();
+}
+
+const uint8_t* v8__CompiledWasmModule__GetWireBytesRef(
+        v8::CompiledWasmModule* self,
+        size_t* length) {
+    WASM_DISABLED();
+}
+
+const char* v8__CompiledWasmModule__SourceUrl(
+        const v8::CompiledWasmModule& self,
+        size_t* length) {
+    WASM_DISABLED();
+}
+
+SharedPtr v8__WasmStreaming__Unpack(
+        v8::Isolate* isolate,
+        const v8::Value& value) {
+    WASM_DISABLED();
+}
+
+void std__shared_ptr__v8__WasmStreaming__reset(std::shared_ptr<v8::WasmStreaming>* self) { WASM_DISABLED(); }
+
+void v8__WasmStreaming__OnBytesReceived(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const uint8_t* bytes,
+        size_t size) {
+    WASM_DISABLED();
+}
+
+void v8__WasmStreaming__Finish(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        bool can_use_compiled_module) {
+    WASM_DISABLED();
+}
+
+void v8__WasmStreaming__Abort(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const v8::Value* exception) {
+    WASM_DISABLED();
+}
+
+bool v8__WasmStreaming__SetCompiledModuleBytes(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const uint8_t* bytes,
+        size_t size) {
+    WASM_DISABLED();
+}
+
+void v8__WasmStreaming__SetUrl(
+        const std::shared_ptr<v8::WasmStreaming>& self,
+        const char* url,
+        size_t length) {
+    WASM_DISABLED();
+}
+
+#undef WASM_DISABLED
+
+#endif // V8_ENABLE_WEBASSEMBLY
+
 // JSON
 
 const v8::Value* v8__JSON__Parse(
@@ -1394,4 +2675,8 @@ void v8__base__SetDcheckFunction(void (*func)(const char*, int, const char*)) {
     v8::base::SetDcheckFunction(func);
 }
 
-}
\ No newline at end of file
+}
+
+#if defined(__GNUC__)
+#pragma GCC visibility pop
+#endif
@@ -28,12 +28,26 @@ typedef Value Primitive;
 typedef Value Integer;
 typedef Value BigInt;
 typedef Value Array;
+typedef Value TypedArray;
+typedef Value Int8Array;
 typedef Value Uint8Array;
+typedef Value Uint8ClampedArray;
+typedef Value Int16Array;
+typedef Value Uint16Array;
+typedef Value Int32Array;
+typedef Value Uint32Array;
+typedef Value Float32Array;
+typedef Value Float64Array;
+typedef Value BigInt64Array;
+typedef Value BigUint64Array;
+typedef Value DataView;
+typedef Value SharedArrayBuffer;
 typedef Value ArrayBufferView;
 typedef Value External;
 typedef Value Boolean;
 typedef Value Promise;
 typedef Value PromiseResolver;
+typedef Value WasmModuleObject;
 typedef enum CompileOptions {
     kNoCompileOptions = 0,
     kConsumeCodeCache = 1,
@@ -113,6 +127,8 @@ typedef struct Platform Platform;
 Platform* v8__Platform__NewDefaultPlatform(int thread_pool_size, int idle_task_support);
 void v8__Platform__DELETE(Platform* platform);
 bool v8__Platform__PumpMessageLoop(Platform* platform, Isolate* isolate, bool wait_for_work);
+void v8__Platform__RunIdleTasks(Platform* platform, Isolate* isolate, double idle_time_in_seconds);
+double v8__Platform__MonotonicallyIncreasingTime(Platform* platform);
 
 // Root
 const Primitive* v8__Undefined(Isolate* isolate);
@@ -130,9 +146,47 @@ void v8__V8__Initialize();
 int v8__V8__Dispose();
 void v8__V8__DisposePlatform();
 const char* v8__V8__GetVersion();
+void v8__V8__InitializeExternalStartupData(const char* directory_path);
+void v8__V8__InitializeExternalStartupDataFromFile(const char* snapshot_blob);
 
 // Microtask
 typedef enum MicrotasksPolicy { kExplicit, kScoped, kAuto } MicrotasksPolicy;
+typedef struct MicrotaskQueue MicrotaskQueue;
+typedef void (*MicrotaskCallback)(void* data);
+MicrotaskQueue* v8__MicrotaskQueue__New(Isolate* isolate, MicrotasksPolicy policy);
+void v8__MicrotaskQueue__DELETE(MicrotaskQueue* self);
+void v8__MicrotaskQueue__EnqueueMicrotask(
+    MicrotaskQueue* self,
+    Isolate* isolate,
+    const Function* microtask);
+void v8__MicrotaskQueue__EnqueueMicrotask__CALLBACK(
+    MicrotaskQueue* self,
+    Isolate* isolate,
+    MicrotaskCallback callback,
+    void* data);
+void v8__MicrotaskQueue__PerformCheckpoint(MicrotaskQueue* self, Isolate* isolate);
+bool v8__MicrotaskQueue__IsRunningMicrotasks(const MicrotaskQueue* self);
+int v8__MicrotaskQueue__GetMicrotasksScopeDepth(const MicrotaskQueue* self);
+
+// MicrotasksScope
+typedef enum MicrotasksScopeType {
+    kRunMicrotasks,
+    kDoNotRunMicrotasks,
+} MicrotasksScopeType;
+typedef struct MicrotasksScope {
+    void* i_isolate_;
+    void* microtask_queue_;
+    bool run_;
+} MicrotasksScope;
+size_t v8__MicrotasksScope__SIZEOF();
+void v8__MicrotasksScope__CONSTRUCT(
+    MicrotasksScope* buf,
+    const Context* context,
+    MicrotasksScopeType type);
+void v8__MicrotasksScope__DESTRUCT(MicrotasksScope* self);
+void v8__MicrotasksScope__PerformCheckpoint(Isolate* isolate);
+int v8__MicrotasksScope__GetCurrentDepth(Isolate* isolate);
+bool v8__MicrotasksScope__IsRunningMicrotasks(Isolate* isolate);
 
 // Isolate
 Isolate* v8__Isolate__New(CreateParams* params);
@@ -151,6 +205,11 @@ void v8__Isolate__SetMicrotasksPolicy(
     Isolate* self,
     MicrotasksPolicy policy);
 void v8__Isolate__PerformMicrotaskCheckpoint(Isolate* self);
+void v8__Isolate__EnqueueMicrotask(Isolate* self, const Function* microtask);
+void v8__Isolate__EnqueueMicrotask__CALLBACK(
+    Isolate* self,
+    MicrotaskCallback callback,
+    void* data);
 bool v8__Isolate__AddMessageListener(
     Isolate* self,
     MessageCallback callback);
@@ -167,6 +226,22 @@ void v8__Isolate__TerminateExecution(Isolate* self);
 bool v8__Isolate__IsExecutionTerminating(Isolate* self);
 void v8__Isolate__CancelTerminateExecution(Isolate* self);
 void v8__Isolate__LowMemoryNotification(Isolate* self);
+typedef enum MemoryPressureLevel {
+    kMemoryPressureNone,
+    kMemoryPressureModerate,
+    kMemoryPressureCritical,
+} MemoryPressureLevel;
+void v8__Isolate__MemoryPressureNotification(Isolate* self, MemoryPressureLevel level);
+void v8__Isolate__IsolateInBackgroundNotification(Isolate* self);
+void v8__Isolate__IsolateInForegroundNotification(Isolate* self);
+typedef enum RAILMode {
+    PERFORMANCE_RESPONSE,
+    PERFORMANCE_ANIMATION,
+    PERFORMANCE_IDLE,
+    PERFORMANCE_LOAD,
+} RAILMode;
+void v8__Isolate__SetRAILMode(Isolate* self, RAILMode rail_mode);
+int v8__Isolate__ContextDisposedNotification(Isolate* self, bool dependant_context);
 typedef struct HeapStatistics {
     size_t total_heap_size;
     size_t total_heap_size_executable;
@@ -192,6 +267,23 @@ typedef struct StartupData {
     const char* data;
     int raw_size;
 } StartupData;
+void v8__StartupData__DeleteData(StartupData* self);
+void v8__V8__SetSnapshotDataBlob(StartupData* startup_blob);
+
+// SnapshotCreator
+typedef struct SnapshotCreator SnapshotCreator;
+typedef enum FunctionCodeHandling {
+    kFunctionCodeClear,
+    kFunctionCodeKeep,
+} FunctionCodeHandling;
+SnapshotCreator* v8__SnapshotCreator__NEW(
+    const intptr_t* external_references,
+    const StartupData* existing_blob);
+void v8__SnapshotCreator__DELETE(SnapshotCreator* self);
+Isolate* v8__SnapshotCreator__GetIsolate(SnapshotCreator* self);
+void v8__SnapshotCreator__SetDefaultContext(SnapshotCreator* self, const Context* context);
+size_t v8__SnapshotCreator__AddContext(SnapshotCreator* self, const Context* context);
+StartupData v8__SnapshotCreator__CreateBlob(SnapshotCreator* self, FunctionCodeHandling function_code_handling);
 
 typedef struct ResourceConstraints {
     usize code_range_size_;
@@ -238,6 +330,9 @@ void v8__ArrayBuffer__Allocator__DELETE(ArrayBufferAllocator* self);
 BackingStore* v8__ArrayBuffer__NewBackingStore(
     Isolate* isolate,
     size_t byte_len);
+BackingStore* v8__ArrayBuffer__NewResizableBackingStore(
+    size_t byte_len,
+    size_t max_byte_len);
 BackingStore* v8__ArrayBuffer__NewBackingStore2(
     void* data,
     size_t byte_len,
@@ -246,7 +341,13 @@ BackingStore* v8__ArrayBuffer__NewBackingStore2(
 void* v8__BackingStore__Data(const BackingStore* self);
 size_t v8__BackingStore__ByteLength(const BackingStore* self);
 bool v8__BackingStore__IsShared(const BackingStore* self);
+bool v8__BackingStore__IsResizableByUserJavaScript(const BackingStore* self);
 SharedPtr v8__BackingStore__TO_SHARED_PTR(BackingStore* unique_ptr);
+void v8__BackingStore__DELETE(BackingStore* self);
+BackingStore* v8__BackingStore__Reallocate(
+    Isolate* isolate,
+    BackingStore* unique_ptr,
+    size_t byte_length);
 void std__shared_ptr__v8__BackingStore__reset(SharedPtr* self);
 BackingStore* std__shared_ptr__v8__BackingStore__get(const SharedPtr* self);
 long std__shared_ptr__v8__BackingStore__use_count(const SharedPtr* self);
@@ -254,9 +355,101 @@ const ArrayBuffer* v8__ArrayBuffer__New(Isolate* isolate, size_t byte_len);
 const ArrayBuffer* v8__ArrayBuffer__New2(Isolate* isolate, const SharedPtr* backing_store);
 size_t v8__ArrayBuffer__ByteLength(const ArrayBuffer* self);
 SharedPtr v8__ArrayBuffer__GetBackingStore(const ArrayBuffer* self);
+bool v8__ArrayBuffer__IsDetachable(const ArrayBuffer* self);
+bool v8__ArrayBuffer__WasDetached(const ArrayBuffer* self);
+void v8__ArrayBuffer__Detach(
+    const ArrayBuffer* self,
+    const Value* key,
+    MaybeBool* out);
+void v8__ArrayBuffer__SetDetachKey(const ArrayBuffer* self, const Value* key);
+
+// SharedArrayBuffer
+BackingStore* v8__SharedArrayBuffer__NewBackingStore(
+    Isolate* isolate,
+    size_t byte_len);
+const SharedArrayBuffer* v8__SharedArrayBuffer__New(Isolate* isolate, size_t byte_len);
+const SharedArrayBuffer* v8__SharedArrayBuffer__New2(Isolate* isolate, const SharedPtr* backing_store);
+size_t v8__SharedArrayBuffer__ByteLength(const SharedArrayBuffer* self);
+SharedPtr v8__SharedArrayBuffer__GetBackingStore(const SharedArrayBuffer* self);
+typedef enum AtomicsWaitEvent {
+    kStartWait,
+    kWokenUp,
+    kTimedOut,
+    kTerminatedExecution,
+    kAPIStopped,
+    kNotEqual,
+} AtomicsWaitEvent;
+typedef struct AtomicsWaitWakeHandle AtomicsWaitWakeHandle;
+typedef void (*AtomicsWaitCallback)(
+    AtomicsWaitEvent event,
+    const SharedArrayBuffer* array_buffer,
+    size_t offset_in_bytes,
+    int64_t value,
+    double timeout_in_ms,
+    AtomicsWaitWakeHandle* stop_handle,
+    void* data);
+void v8__Isolate__SetAtomicsWaitCallback(
+    Isolate* isolate,
+    AtomicsWaitCallback callback,
+    void* data);
+void v8__AtomicsWaitWakeHandle__Wake(AtomicsWaitWakeHandle* self);
 
 // ArrayBufferView
 const ArrayBuffer* v8__ArrayBufferView__Buffer(const ArrayBufferView* self);
+size_t v8__ArrayBufferView__ByteOffset(const ArrayBufferView* self);
+size_t v8__ArrayBufferView__ByteLength(const ArrayBufferView* self);
+size_t v8__ArrayBufferView__CopyContents(
+    const ArrayBufferView* self,
+    void* dest,
+    size_t byte_length);
+bool v8__ArrayBufferView__HasBuffer(const ArrayBufferView* self);
+
+// TypedArray
+size_t v8__TypedArray__Length(const TypedArray* self);
+const Int8Array* v8__Int8Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const Uint8ClampedArray* v8__Uint8ClampedArray__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const Int16Array* v8__Int16Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const Uint16Array* v8__Uint16Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const Int32Array* v8__Int32Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const Uint32Array* v8__Uint32Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const Float32Array* v8__Float32Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const Float64Array* v8__Float64Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const BigInt64Array* v8__BigInt64Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const BigUint64Array* v8__BigUint64Array__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
+const DataView* v8__DataView__New(
+    const ArrayBuffer* buf,
+    size_t byte_offset,
+    size_t length);
 
 // HandleScope
 typedef struct HandleScope {
@@ -267,6 +460,29 @@ typedef struct HandleScope {
 } HandleScope;
 void v8__HandleScope__CONSTRUCT(HandleScope* buf, Isolate* isolate);
 void v8__HandleScope__DESTRUCT(HandleScope* scope);
+size_t v8__HandleScope__SIZEOF();
+
+// EscapableHandleScope
+typedef struct EscapableHandleScope {
+    HandleScope inner;
+    // internal vars.
+    InternalAddress* escape_slot_;
+} EscapableHandleScope;
+size_t v8__EscapableHandleScope__SIZEOF();
+void v8__EscapableHandleScope__CONSTRUCT(EscapableHandleScope* buf, Isolate* isolate);
+void v8__EscapableHandleScope__DESTRUCT(EscapableHandleScope* scope);
+const Data* v8__EscapableHandleScope__Escape(EscapableHandleScope* self, const Data* value);
+
+// SealHandleScope
+typedef struct SealHandleScope {
+    // internal vars.
+    void* isolate_;
+    InternalAddress* prev_limit_;
+    int prev_sealed_level_;
+} SealHandleScope;
+size_t v8__SealHandleScope__SIZEOF();
+void v8__SealHandleScope__CONSTRUCT(SealHandleScope* buf, Isolate* isolate);
+void v8__SealHandleScope__DESTRUCT(SealHandleScope* scope);
 
 // Message
 const String* v8__Message__Get(const Message* self);
@@ -324,6 +540,16 @@ bool v8__StackFrame__IsUserJavaScript(const StackFrame* self);
 typedef struct Context Context;
 typedef struct ObjectTemplate ObjectTemplate;
 Context* v8__Context__New(Isolate* isolate, const ObjectTemplate* global_tmpl, const Value* global_obj);
+Context* v8__Context__New__QUEUE(
+    Isolate* isolate,
+    const ObjectTemplate* global_tmpl,
+    const Value* global_obj,
+    MicrotaskQueue* queue);
+MicrotaskQueue* v8__Context__GetMicrotaskQueue(const Context* self);
+const Context* v8__Context__FromSnapshot(
+    Isolate* isolate,
+    size_t context_snapshot_index,
+    MicrotaskQueue* queue);
 void v8__Context__Enter(const Context* context);
 void v8__Context__Exit(const Context* context);
 Isolate* v8__Context__GetIsolate(const Context* context);
@@ -397,8 +623,21 @@ bool v8__Value__IsObject(const Value* self);
 bool v8__Value__IsString(const Value* self);
 bool v8__Value__IsArray(const Value* self);
 bool v8__Value__IsArrayBuffer(const Value* self);
+bool v8__Value__IsSharedArrayBuffer(const Value* self);
 bool v8__Value__IsArrayBufferView(const Value* self);
+bool v8__Value__IsTypedArray(const Value* self);
+bool v8__Value__IsInt8Array(const Value* self);
 bool v8__Value__IsUint8Array(const Value* self);
+bool v8__Value__IsUint8ClampedArray(const Value* self);
+bool v8__Value__IsInt16Array(const Value* self);
+bool v8__Value__IsUint16Array(const Value* self);
+bool v8__Value__IsInt32Array(const Value* self);
+bool v8__Value__IsUint32Array(const Value* self);
+bool v8__Value__IsFloat32Array(const Value* self);
+bool v8__Value__IsFloat64Array(const Value* self);
+bool v8__Value__IsBigInt64Array(const Value* self);
+bool v8__Value__IsBigUint64Array(const Value* self);
+bool v8__Value__IsDataView(const Value* self);
 bool v8__Value__IsExternal(const Value* self);
 bool v8__Value__IsTrue(const Value* self);
 bool v8__Value__IsFalse(const Value* self);
@@ -408,6 +647,7 @@ bool v8__Value__IsNullOrUndefined(const Value* self);
 bool v8__Value__IsNativeError(const Value* self);
 bool v8__Value__IsBigInt(const Value* self);
 bool v8__Value__IsBigIntObject(const Value* self);
+bool v8__Value__IsWasmModuleObject(const Value* self);
 void v8__Value__InstanceOf(
     const Value* self,
     const Context* ctx,
@@ -456,9 +696,39 @@ const Array* v8__Array__New2(
     const Value* const elements[],
     size_t length);
 uint32_t v8__Array__Length(const Array* self);
+const Array* v8__Array__New__F64(
+    Isolate* isolate,
+    const double* elements,
+    size_t length);
+const Array* v8__Array__New__I32(
+    Isolate* isolate,
+    const int32_t* elements,
+    size_t length);
+const Array* v8__Array__New__U32(
+    Isolate* isolate,
+    const uint32_t* elements,
+    size_t length);
+bool v8__Array__CopyTo__VALUES(
+    const Array* self,
+    const Context* ctx,
+    const Value** out,
+    size_t length,
+    size_t* out_copied);
+bool v8__Array__CopyTo__F64(
+    const Array* self,
+    const Context* ctx,
+    double* out,
+    size_t length,
+    size_t* out_copied);
 
 // Object
 const Object* v8__Object__New(Isolate* isolate);
+const Object* v8__Object__New2(
+    Isolate* isolate,
+    const Value* prototype,
+    const Name* const names[],
+    const Value* const values[],
+    size_t length);
 const Value* v8__Object__GetInternalField(
     const Object* self,
     int index);
@@ -480,6 +750,18 @@ void v8__Object__Set(
     const Value* key,
     const Value* value,
     MaybeBool* out);
+bool v8__Object__Get__BATCH(
+    const Object* self,
+    const Context* ctx,
+    const Value* const keys[],
+    const Value** out_values,
+    size_t length);
+bool v8__Object__Set__BATCH(
+    const Object* self,
+    const Context* ctx,
+    const Value* const keys[],
+    const Value* const values[],
+    size_t length);
 void v8__Object__DefineOwnProperty(
     const Object* self,
     const Context* ctx,
@@ -490,6 +772,7 @@ void v8__Object__DefineOwnProperty(
 Isolate* v8__Object__GetIsolate(const Object* self);
 const Context* v8__Object__GetCreationContext(const Object* self);
 int v8__Object__GetIdentityHash(const Object* self);
+const Value* v8__Object__GetPrototype(const Object* self);
 void v8__Object__Has(
     const Object* self,
     const Context* ctx,
@@ -510,6 +793,9 @@ void v8__Object__SetAlignedPointerInInternalField(
     const Object* self,
     int idx,
     void* ptr);
+void* v8__Object__GetAlignedPointerFromInternalField(
+    const Object* self,
+    int idx);
 
 // Exception
 const Value* v8__Exception__Error(const String* message);
@@ -590,6 +876,8 @@ void v8__PropertyCallbackInfo__GetReturnValue(
     ReturnValue* res);
 const Object* v8__PropertyCallbackInfo__This(
     const PropertyCallbackInfo* self);
+const Object* v8__PropertyCallbackInfo__Holder(
+    const PropertyCallbackInfo* self);
 const Value* v8__PropertyCallbackInfo__Data(
     const PropertyCallbackInfo* self);
 
@@ -613,6 +901,24 @@ void v8__ReturnValue__Set(
     const Value* value);
 const Value* v8__ReturnValue__Get(
     const ReturnValue self);
+void v8__ReturnValue__SetInt32(
+    const ReturnValue self,
+    int32_t value);
+void v8__ReturnValue__SetUint32(
+    const ReturnValue self,
+    uint32_t value);
+void v8__ReturnValue__SetDouble(
+    const ReturnValue self,
+    double value);
+void v8__ReturnValue__SetBool(
+    const ReturnValue self,
+    bool value);
+void v8__ReturnValue__SetNull(
+    const ReturnValue self);
+void v8__ReturnValue__SetUndefined(
+    const ReturnValue self);
+void v8__ReturnValue__SetEmptyString(
+    const ReturnValue self);
 
 // FunctionTemplate
 typedef void (*FunctionCallback)(const FunctionCallbackInfo*);
@@ -625,6 +931,15 @@ const FunctionTemplate* v8__FunctionTemplate__New__DEFAULT3(
     Isolate* isolate,
     FunctionCallback callback_or_null,
     const Value* data);
+typedef struct Signature Signature;
+const Signature* v8__Signature__New(
+    Isolate* isolate,
+    const FunctionTemplate* receiver);
+const FunctionTemplate* v8__FunctionTemplate__New__DEFAULT4(
+    Isolate* isolate,
+    FunctionCallback callback_or_null,
+    const Value* data_or_null,
+    const Signature* signature);
 const ObjectTemplate* v8__FunctionTemplate__InstanceTemplate(
     const FunctionTemplate* self);
 const ObjectTemplate* v8__FunctionTemplate__PrototypeTemplate(
@@ -691,6 +1006,96 @@ void v8__Persistent__SetWeakFinalizer(
     WeakCallback finalizer_cb,
     WeakCallbackType type);
 
+// Global
+typedef struct Global {
+    uintptr_t data_ptr;
+} Global;
+size_t v8__Global__SIZEOF();
+void v8__Global__New(
+    Isolate* isolate,
+    const Data* data,
+    Global* out);
+void v8__Global__Reset(
+    Global* self);
+void v8__Global__MOVE(
+    Global* self,
+    Global* out);
+void v8__Global__MOVE_CONSTRUCT(
+    Global* self,
+    Global* out);
+void v8__Global__Reset__BATCH(
+    Global* handles,
+    size_t length);
+
+// TracedReference
+typedef struct TracedReference {
+    uintptr_t data_ptr;
+} TracedReference;
+size_t v8__TracedReference__SIZEOF();
+void v8__TracedReference__CONSTRUCT(TracedReference* buf);
+void v8__TracedReference__DESTRUCT(TracedReference* self);
+void v8__TracedReference__Reset(
+    TracedReference* self,
+    Isolate* isolate,
+    const Value* value);
+void v8__TracedReference__Reset__EMPTY(TracedReference* self);
+const Value* v8__TracedReference__Get(
+    const TracedReference* self,
+    Isolate* isolate);
+bool v8__TracedReference__IsEmpty(const TracedReference* self);
+
+// CppHeap
+typedef struct CppHeap CppHeap;
+typedef struct CppgcVisitor CppgcVisitor;
+typedef struct GcObject GcObject;
+typedef struct GcObjectVtable {
+    void (*trace)(const void* data, CppgcVisitor* visitor);
+    void (*finalize)(void* data);
+} GcObjectVtable;
+typedef void (*GcObjectInit)(void* data, const void* init_data);
+typedef struct GcMember {
+    uintptr_t raw;
+} GcMember;
+void v8__cppgc__InitializeProcess(Platform* platform);
+void v8__cppgc__ShutdownProcess();
+CppHeap* v8__CppHeap__Create(
+    Platform* platform,
+    int wrappable_type_index,
+    int wrappable_instance_index,
+    uint16_t embedder_id);
+void v8__CppHeap__Terminate(CppHeap* self);
+void v8__CppHeap__DELETE(CppHeap* self);
+void v8__Isolate__AttachCppHeap(Isolate* isolate, CppHeap* heap);
+void v8__Isolate__DetachCppHeap(Isolate* isolate);
+CppHeap* v8__Isolate__GetCppHeap(const Isolate* isolate);
+GcObject* v8__cppgc__MakeGarbageCollected(
+    CppHeap* heap,
+    size_t size,
+    const GcObjectVtable* vtable,
+    GcObjectInit init,
+    const void* init_data);
+void* v8__GcObject__Data(const GcObject* self);
+GcObject* v8__GcObject__FromData(const void* data);
+size_t v8__GcMember__SIZEOF();
+void v8__GcMember__CONSTRUCT(GcMember* buf);
+void v8__GcMember__Set(GcMember* self, const GcObject* value);
+const GcObject* v8__GcMember__Get(const GcMember* self);
+void v8__CppgcVisitor__TraceMember(CppgcVisitor* self, const GcMember* member);
+void v8__CppgcVisitor__TraceReference(CppgcVisitor* self, const TracedReference* ref);
+
+// Eternal
+typedef struct Eternal {
+    uintptr_t data_ptr;
+} Eternal;
+size_t v8__Eternal__SIZEOF();
+void v8__Eternal__New(
+    Isolate* isolate,
+    const Data* data,
+    Eternal* out);
+const Data* v8__Eternal__Get(
+    const Eternal* self,
+    Isolate* isolate);
+
 // WeakCallbackInfo
 Isolate* v8__WeakCallbackInfo__GetIsolate(const WeakCallbackInfo* self);
 void* v8__WeakCallbackInfo__GetParameter(const WeakCallbackInfo* self);
@@ -720,6 +1125,70 @@ void v8__ObjectTemplate__SetAccessor__DEFAULT2(
     const Name* key,
     AccessorNameGetterCallback getter,
     AccessorNameSetterCallback setter);
+typedef enum PropertyHandlerFlags {
+    kNone = 0,
+    kAllCanRead = 1,
+    kNonMasking = 1 << 1,
+    kOnlyInterceptStrings = 1 << 2,
+    kHasNoSideEffect = 1 << 3,
+} PropertyHandlerFlags;
+typedef struct PropertyDescriptor PropertyDescriptor;
+typedef void (*NamedPropertyGetterCallback)(const Name*, const PropertyCallbackInfo*);
+typedef void (*NamedPropertySetterCallback)(const Name*, const Value*, const PropertyCallbackInfo*);
+typedef void (*NamedPropertyQueryCallback)(const Name*, const PropertyCallbackInfo*);
+typedef void (*NamedPropertyDeleterCallback)(const Name*, const PropertyCallbackInfo*);
+typedef void (*NamedPropertyEnumeratorCallback)(const PropertyCallbackInfo*);
+typedef void (*NamedPropertyDefinerCallback)(const Name*, const PropertyDescriptor*, const PropertyCallbackInfo*);
+typedef void (*NamedPropertyDescriptorCallback)(const Name*, const PropertyCallbackInfo*);
+typedef struct NamedPropertyHandlerConfiguration {
+    NamedPropertyGetterCallback getter;
+    NamedPropertySetterCallback setter;
+    NamedPropertyQueryCallback query;
+    NamedPropertyDeleterCallback deleter;
+    NamedPropertyEnumeratorCallback enumerator;
+    NamedPropertyDefinerCallback definer;
+    NamedPropertyDescriptorCallback descriptor;
+    const Value* data;
+    PropertyHandlerFlags flags;
+} NamedPropertyHandlerConfiguration;
+typedef void (*IndexedPropertyGetterCallback)(uint32_t, const PropertyCallbackInfo*);
+typedef void (*IndexedPropertySetterCallback)(uint32_t, const Value*, const PropertyCallbackInfo*);
+typedef void (*IndexedPropertyQueryCallback)(uint32_t, const PropertyCallbackInfo*);
+typedef void (*IndexedPropertyDeleterCallback)(uint32_t, const PropertyCallbackInfo*);
+typedef void (*IndexedPropertyEnumeratorCallback)(const PropertyCallbackInfo*);
+typedef void (*IndexedPropertyDefinerCallback)(uint32_t, const PropertyDescriptor*, const PropertyCallbackInfo*);
+typedef void (*IndexedPropertyDescriptorCallback)(uint32_t, const PropertyCallbackInfo*);
+typedef struct IndexedPropertyHandlerConfiguration {
+    IndexedPropertyGetterCallback getter;
+    IndexedPropertySetterCallback setter;
+    IndexedPropertyQueryCallback query;
+    IndexedPropertyDeleterCallback deleter;
+    IndexedPropertyEnumeratorCallback enumerator;
+    IndexedPropertyDefinerCallback definer;
+    IndexedPropertyDescriptorCallback descriptor;
+    const Value* data;
+    PropertyHandlerFlags flags;
+} IndexedPropertyHandlerConfiguration;
+void v8__ObjectTemplate__SetNamedHandler(
+    const ObjectTemplate* self,
+    const NamedPropertyHandlerConfiguration* config);
+void v8__ObjectTemplate__SetIndexedHandler(
+    const ObjectTemplate* self,
+    const IndexedPropertyHandlerConfiguration* config);
+
+// PropertyDescriptor
+bool v8__PropertyDescriptor__has_value(const PropertyDescriptor* self);
+const Value* v8__PropertyDescriptor__value(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__has_get(const PropertyDescriptor* self);
+const Value* v8__PropertyDescriptor__get(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__has_set(const PropertyDescriptor* self);
+const Value* v8__PropertyDescriptor__set(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__has_enumerable(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__enumerable(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__has_configurable(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__configurable(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__has_writable(const PropertyDescriptor* self);
+bool v8__PropertyDescriptor__writable(const PropertyDescriptor* self);
 
 // ScriptOrigin
 typedef struct ScriptOriginOptions {
@@ -790,6 +1259,7 @@ void v8__ScriptCompiler__Source__CONSTRUCT2(
     ScriptCompilerCachedData* cached_data,
     ScriptCompilerSource* out);
 void v8__ScriptCompiler__Source__DESTRUCT(ScriptCompilerSource* self);
+const ScriptCompilerCachedData* v8__ScriptCompiler__Source__GetCachedData(const ScriptCompilerSource* self);
 size_t v8__ScriptCompiler__CachedData__SIZEOF();
 ScriptCompilerCachedData* v8__ScriptCompiler__CachedData__NEW(
     const uint8_t* data,
@@ -803,8 +1273,34 @@ const Module* v8__ScriptCompiler__CompileModule(
 
 // Script
 typedef struct Script Script;
+typedef struct UnboundScript UnboundScript;
 Script* v8__Script__Compile(const Context* context, const String* src, const ScriptOrigin* origin);
 Value* v8__Script__Run(const Script* script, const Context* context);
+const UnboundScript* v8__Script__GetUnboundScript(const Script* script);
+
+// UnboundScript
+const Script* v8__UnboundScript__BindToCurrentContext(const UnboundScript* self);
+const Script* v8__ScriptCompiler__Compile(
+    const Context* context,
+    ScriptCompilerSource* source,
+    CompileOptions options,
+    NoCacheReason reason);
+const UnboundScript* v8__ScriptCompiler__CompileUnboundScript(
+    Isolate* isolate,
+    ScriptCompilerSource* source,
+    CompileOptions options,
+    NoCacheReason reason);
+ScriptCompilerCachedData* v8__ScriptCompiler__CreateCodeCache(const UnboundScript* unbound_script);
+const Function* v8__ScriptCompiler__CompileFunction(
+    const Context* context,
+    ScriptCompilerSource* source,
+    size_t arguments_count,
+    const String* const arguments[],
+    size_t context_extensions_count,
+    const Object* const context_extensions[],
+    CompileOptions options,
+    NoCacheReason reason);
+ScriptCompilerCachedData* v8__ScriptCompiler__CreateCodeCacheForFunction(const Function* function);
 
 // Module
 typedef enum ModuleStatus {
@@ -835,6 +1331,68 @@ typedef Data ModuleRequest;
 const String* v8__ModuleRequest__GetSpecifier(const ModuleRequest* self);
 int v8__ModuleRequest__GetSourceOffset(const ModuleRequest* self);
 
+// WasmModuleObject
+typedef struct CompiledWasmModule CompiledWasmModule;
+const WasmModuleObject* v8__WasmModuleObject__Compile(
+    Isolate* isolate,
+    const uint8_t* wire_bytes,
+    size_t wire_bytes_len);
+const WasmModuleObject* v8__WasmModuleObject__DeserializeOrCompile(
+    Isolate* isolate,
+    const uint8_t* serialized_module,
+    size_t serialized_module_len,
+    const uint8_t* wire_bytes,
+    size_t wire_bytes_len);
+const WasmModuleObject* v8__WasmModuleObject__FromCompiledModule(
+    Isolate* isolate,
+    const CompiledWasmModule* compiled_module);
+CompiledWasmModule* v8__WasmModuleObject__GetCompiledModule(
+    const WasmModuleObject* self);
+
+// CompiledWasmModule
+typedef struct OwnedBuffer {
+    const uint8_t* data;
+    size_t size;
+} OwnedBuffer;
+void v8__CompiledWasmModule__DELETE(CompiledWasmModule* self);
+void v8__CompiledWasmModule__Serialize(
+    CompiledWasmModule* self,
+    OwnedBuffer* out);
+const uint8_t* v8__CompiledWasmModule__GetWireBytesRef(
+    CompiledWasmModule* self,
+    size_t* length);
+const char* v8__CompiledWasmModule__SourceUrl(
+    const CompiledWasmModule* self,
+    size_t* length);
+void v8__OwnedBuffer__DELETE(OwnedBuffer* self);
+
+// WasmStreaming
+void v8__Isolate__SetWasmStreamingCallback(
+    Isolate* isolate,
+    FunctionCallback callback);
+SharedPtr v8__WasmStreaming__Unpack(
+    Isolate* isolate,
+    const Value* value);
+void std__shared_ptr__v8__WasmStreaming__reset(SharedPtr* self);
+void v8__WasmStreaming__OnBytesReceived(
+    const SharedPtr* self,
+    const uint8_t* bytes,
+    size_t size);
+void v8__WasmStreaming__Finish(
+    const SharedPtr* self,
+    bool can_use_compiled_module);
+void v8__WasmStreaming__Abort(
+    const SharedPtr* self,
+    const Value* exception);
+bool v8__WasmStreaming__SetCompiledModuleBytes(
+    const SharedPtr* self,
+    const uint8_t* bytes,
+    size_t size);
+void v8__WasmStreaming__SetUrl(
+    const SharedPtr* self,
+    const char* url,
+    size_t length);
+
 // JSON
 const Value* v8__JSON__Parse(
     const Context* ctx,
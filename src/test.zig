@@ -1,22 +1,77 @@
 const std = @import("std");
 const t = std.testing;
 const v8 = @import("./v8.zig");
+const build_options = @import("build_options");
+
+// V8 can only be initialized once per process and can't be initialized again after it's disposed,
+// so all tests share the platform and it stays up until the test runner exits.
+var test_platform: ?v8.Platform = null;
+
+fn initTestPlatform() v8.Platform {
+    if (test_platform == null) {
+        const platform = v8.Platform.initDefault(0, true);
+        v8.initV8Platform(platform);
+        if (build_options.v8_startup_data_dir) |dir| {
+            v8.initV8ExternalStartupData(dir);
+        }
+        v8.initV8();
+        v8.initCppgcProcess(platform);
+        test_platform = platform;
+    }
+    return test_platform.?;
+}
+
+fn evalIn(ctx: v8.Context, src: []const u8) !v8.Value {
+    const script = try v8.Script.compile(ctx, v8.String.initUtf8(ctx.getIsolate(), src), null);
+    return script.run(ctx);
+}
+
+/// An entered isolate and context. Initialized in place since the HandleScope must not move.
+const TestEnv = struct {
+    const Self = @This();
+
+    params: v8.CreateParams,
+    isolate: v8.Isolate,
+    hscope: v8.HandleScope,
+    context: v8.Context,
+
+    fn init(self: *Self) void {
+        _ = initTestPlatform();
+        self.params = v8.initCreateParams();
+        self.params.array_buffer_allocator = v8.createDefaultArrayBufferAllocator();
+        self.isolate = v8.Isolate.init(&self.params);
+        self.isolate.enter();
+        self.hscope.init(self.isolate);
+        self.context = v8.Context.init(self.isolate, null, null);
+        self.context.enter();
+    }
+
+    fn deinit(self: *Self) void {
+        self.context.exit();
+        self.hscope.deinit();
+        self.isolate.exit();
+        self.isolate.deinit();
+        v8.destroyArrayBufferAllocator(self.params.array_buffer_allocator.?);
+    }
+
+    fn eval(self: Self, src: []const u8) !v8.Value {
+        return evalIn(self.context, src);
+    }
+
+    fn expectString(self: Self, expected: []const u8, val: v8.Value) !void {
+        const res = valueToRawUtf8Alloc(t.allocator, self.isolate, self.context, val);
+        defer t.allocator.free(res);
+        try t.expectEqualStrings(expected, res);
+    }
+};
 
 test {
     // Based on https://chromium.googlesource.com/v8/v8/+/branch-heads/6.8/samples/hello-world.cc
 
-    const platform = v8.Platform.initDefault(0, true);
-    defer platform.deinit();
+    _ = initTestPlatform();
 
     std.log.info("v8 version: {s}\n", .{v8.getVersion()});
 
-    v8.initV8Platform(platform);
-    v8.initV8();
-    defer {
-        _ = v8.deinitV8();
-        v8.deinitV8Platform();
-    }
-
     var params = v8.initCreateParams();
     params.array_buffer_allocator = v8.createDefaultArrayBufferAllocator();
     defer v8.destroyArrayBufferAllocator(params.array_buffer_allocator.?);
@@ -54,6 +109,731 @@ test {
     try t.expectEqualStrings(res, "Hello, World! 🍏🍓1");
 }
 
+var intercepted_answer: i32 = 0;
+
+fn isName(iso: v8.Isolate, name: ?*const v8.Name, expected: []const u8) bool {
+    const val = v8.Value{ .handle = @ptrCast(name.?) };
+    if (!val.isString()) {
+        return false;
+    }
+    const str = v8.String{ .handle = @ptrCast(name.?) };
+    var buf: [32]u8 = undefined;
+    if (str.lenUtf8(iso) != expected.len or expected.len > buf.len) {
+        return false;
+    }
+    const len = str.writeUtf8(iso, &buf);
+    return std.mem.eql(u8, buf[0..len], expected);
+}
+
+fn answerGetter(name: ?*const v8.Name, raw_info: ?*const v8.C_PropertyCallbackInfo) callconv(.C) void {
+    const info = v8.PropertyCallbackInfo.initFromV8(raw_info);
+    if (isName(info.getIsolate(), name, "answer")) {
+        info.getReturnValue().set(intercepted_answer);
+    }
+}
+
+fn answerSetter(name: ?*const v8.Name, raw_value: ?*const v8.C_Value, raw_info: ?*const v8.C_PropertyCallbackInfo) callconv(.C) void {
+    const info = v8.PropertyCallbackInfo.initFromV8(raw_info);
+    const iso = info.getIsolate();
+    if (isName(iso, name, "answer")) {
+        const value = v8.Value{ .handle = raw_value.? };
+        intercepted_answer = value.toI32(iso.getCurrentContext()) catch return;
+        info.getReturnValue().set(value);
+    }
+}
+
+fn doubleIndexGetter(idx: u32, raw_info: ?*const v8.C_PropertyCallbackInfo) callconv(.C) void {
+    const info = v8.PropertyCallbackInfo.initFromV8(raw_info);
+    if (idx < 10) {
+        info.getReturnValue().set(idx * 2);
+    }
+}
+
+test "interceptors" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+
+    const tmpl = v8.ObjectTemplate.initDefault(iso);
+    tmpl.setNamedHandler(.{
+        .getter = &answerGetter,
+        .setter = &answerSetter,
+    });
+    tmpl.setIndexedHandler(.{
+        .getter = &doubleIndexGetter,
+    });
+    _ = ctx.getGlobal().setValue(ctx, v8.String.initUtf8(iso, "o"), tmpl.initInstance(ctx));
+
+    intercepted_answer = 42;
+    try t.expectEqual(@as(i32, 42), try (try env.eval("o.answer")).toI32(ctx));
+
+    // The setter intercepts, so the value is not stored on the object.
+    try t.expectEqual(@as(i32, 7), try (try env.eval("o.answer = 7; o.answer")).toI32(ctx));
+    try t.expectEqual(@as(i32, 7), intercepted_answer);
+    try t.expect(!(try env.eval("Object.getOwnPropertyNames(o).includes('answer')")).toBool(iso));
+
+    // Names that aren't intercepted fall through to the object.
+    try t.expect((try env.eval("o.other")).isUndefined());
+    try t.expectEqual(@as(i32, 3), try (try env.eval("o.other = 3; o.other")).toI32(ctx));
+
+    try t.expectEqual(@as(i32, 6), try (try env.eval("o[3]")).toI32(ctx));
+    try t.expect((try env.eval("o[10]")).isUndefined());
+}
+
+var counter_deinits: u32 = 0;
+
+const Counter = struct {
+    count: i32,
+    step: i32,
+
+    pub fn inc(self: *Counter) i32 {
+        self.count += self.step;
+        return self.count;
+    }
+
+    pub fn add(self: *Counter, n: i32) i32 {
+        self.count += n;
+        return self.count;
+    }
+
+    pub fn fail(_: Counter) !i32 {
+        return error.CounterFailed;
+    }
+
+    pub fn deinit(_: *Counter) void {
+        counter_deinits += 1;
+    }
+};
+
+test "Class" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+    const global = ctx.getGlobal();
+
+    // Instances are only freed by the GC, so they are not allocated with the leak checking test allocator.
+    var counters = v8.Class(Counter).init(iso, std.heap.c_allocator);
+    defer counters.deinit();
+
+    const obj = try counters.newInstance(ctx, .{ .count = 1, .step = 2 });
+    _ = global.setValue(ctx, v8.String.initUtf8(iso, "c"), obj);
+    _ = global.setValue(ctx, v8.String.initUtf8(iso, "Counter"), counters.getConstructor(ctx));
+
+    try t.expectEqual(@as(i32, 3), try (try env.eval("c.inc()")).toI32(ctx));
+    try t.expectEqual(@as(i32, 7), try (try env.eval("c.add(4)")).toI32(ctx));
+    try t.expectEqual(@as(i32, 7), try (try env.eval("c.count")).toI32(ctx));
+    _ = try env.eval("c.count = 10");
+    try t.expectEqual(@as(i32, 10), v8.Class(Counter).unwrap(obj).count);
+    try t.expect((try env.eval("c instanceof Counter")).toBool(iso));
+
+    {
+        var try_catch: v8.TryCatch = undefined;
+        try_catch.init(iso);
+        defer try_catch.deinit();
+
+        try t.expectError(error.JsException, env.eval("c.fail()"));
+        try env.expectString("Error: CounterFailed", try_catch.getException().?);
+    }
+    {
+        var try_catch: v8.TryCatch = undefined;
+        try_catch.init(iso);
+        defer try_catch.deinit();
+
+        try t.expectError(error.JsException, env.eval("new Counter()"));
+        try env.expectString("TypeError: Illegal constructor", try_catch.getException().?);
+    }
+    {
+        // The method signature rejects receivers that weren't created from the class.
+        var try_catch: v8.TryCatch = undefined;
+        try_catch.init(iso);
+        defer try_catch.deinit();
+
+        try t.expectError(error.JsException, env.eval("Counter.prototype.inc.call({})"));
+    }
+
+    // An unreachable instance is finalized by a full GC.
+    counter_deinits = 0;
+    {
+        var hscope: v8.HandleScope = undefined;
+        hscope.init(iso);
+        defer hscope.deinit();
+        _ = try counters.newInstance(ctx, .{ .count = 0, .step = 1 });
+    }
+    iso.lowMemoryNotification();
+    try t.expectEqual(@as(u32, 1), counter_deinits);
+}
+
+test "TypedArray" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+
+    // A view that starts after the first element of the buffer.
+    const buf = v8.ArrayBuffer.init(iso, 4 * @sizeOf(f64));
+    const f64s = v8.Float64Array.init(buf, @sizeOf(f64), 3);
+    try t.expectEqual(@as(usize, 3), f64s.length());
+    try t.expectEqual(@as(usize, @sizeOf(f64)), f64s.getByteOffset());
+    try t.expectEqual(@as(usize, 3 * @sizeOf(f64)), f64s.getByteLength());
+
+    const slice = f64s.getSlice();
+    slice[0] = 1.5;
+    slice[1] = 2;
+    slice[2] = 3;
+    _ = ctx.getGlobal().setValue(ctx, v8.String.initUtf8(iso, "f"), f64s);
+    try t.expectEqual(@as(f64, 6.5), try (try env.eval("f[0] + f[1] + f[2]")).toF64(ctx));
+
+    // Writes from JS are visible through the slice and through other views of the buffer.
+    _ = try env.eval("f[2] = 4");
+    try t.expectEqual(@as(f64, 4), slice[2]);
+    const all = v8.Float64Array.init(f64s.getBuffer(), 0, 4);
+    try t.expectEqual(@as(f64, 0), all.getSlice()[0]);
+    try t.expectEqual(@as(f64, 4), all.getSlice()[3]);
+
+    const i32s = (try env.eval("new Int32Array([1, -2, 3])")).castTo(v8.Int32Array);
+    var out: [4]i32 = undefined;
+    try t.expectEqual(@as(usize, 3), i32s.copyContents(&out));
+    try t.expectEqualSlices(i32, &.{ 1, -2, 3 }, out[0..3]);
+
+    const u64s = (try env.eval("new BigUint64Array([1n, 2n ** 64n - 1n])")).castTo(v8.BigUint64Array);
+    try t.expectEqualSlices(u64, &.{ 1, std.math.maxInt(u64) }, u64s.getSlice());
+}
+
+test "ArrayBuffer detach and transfer" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+
+    const buf = v8.ArrayBuffer.init(iso, 8);
+    const bytes = v8.Uint8Array.init(buf, 0, 8);
+    bytes.getSlice()[0] = 42;
+    const key = v8.Object.init(iso);
+    buf.setDetachKey(key);
+    try t.expect(buf.isDetachable());
+
+    {
+        var try_catch: v8.TryCatch = undefined;
+        try_catch.init(iso);
+        defer try_catch.deinit();
+
+        // Neither no key nor the wrong key passes the detach key check, and the store is released on error.
+        try t.expectError(error.JsException, buf.detach(null));
+        try t.expectError(error.JsException, buf.transfer(v8.Object.init(iso).toValue()));
+        try t.expect(try_catch.hasCaught());
+        try t.expect(!buf.wasDetached());
+        try t.expectEqual(@as(usize, 8), buf.getByteLength());
+    }
+
+    var store = try buf.transfer(key.toValue());
+    defer v8.BackingStore.sharedPtrReset(&store);
+    try t.expect(buf.wasDetached());
+    try t.expectEqual(@as(usize, 0), buf.getByteLength());
+    try t.expectEqual(@as(usize, 0), bytes.length());
+    try t.expectEqual(@as(usize, 8), v8.BackingStore.sharedPtrGet(&store).getByteLength());
+
+    // The memory moves to a new buffer without a copy.
+    const moved = v8.ArrayBuffer.initWithBackingStore(iso, &store);
+    try t.expectEqual(@as(usize, 8), moved.getByteLength());
+    try t.expectEqual(@as(u8, 42), v8.Uint8Array.init(moved, 0, 8).getSlice()[0]);
+
+    var resizable = v8.BackingStore.initResizable(4, 16).toSharedPtr();
+    defer v8.BackingStore.sharedPtrReset(&resizable);
+    try t.expect(v8.BackingStore.sharedPtrGet(&resizable).isResizableByUserJavaScript());
+    try t.expectEqual(@as(usize, 4), v8.ArrayBuffer.initWithBackingStore(iso, &resizable).getByteLength());
+}
+
+test "Array bulk construction and draining" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+    const global = ctx.getGlobal();
+
+    _ = global.setValue(ctx, v8.String.initUtf8(iso, "f"), v8.Array.initF64(iso, &.{ 0.5, 1.5, 2 }));
+    _ = global.setValue(ctx, v8.String.initUtf8(iso, "i"), v8.Array.initI32(iso, &.{ -1, 2, std.math.maxInt(i32) }));
+    _ = global.setValue(ctx, v8.String.initUtf8(iso, "u"), v8.Array.initU32(iso, &.{std.math.maxInt(u32)}));
+    try t.expectEqual(@as(f64, 4), try (try env.eval("f.reduce((a, b) => a + b)")).toF64(ctx));
+    try t.expectEqual(@as(f64, std.math.maxInt(i32) + 1), try (try env.eval("i.reduce((a, b) => a + b)")).toF64(ctx));
+    try t.expectEqual(@as(f64, std.math.maxInt(u32)), try (try env.eval("u[0]")).toF64(ctx));
+
+    const arr = (try env.eval("[1, 2.5, 'x', 4]")).castTo(v8.Array);
+    try t.expectEqual(@as(u32, 4), arr.length());
+
+    // Copying numbers stops at the first element that isn't a number.
+    var nums: [8]f64 = undefined;
+    try t.expectEqual(@as(usize, 2), try arr.copyToF64(ctx, &nums));
+    try t.expectEqualSlices(f64, &.{ 1, 2.5 }, nums[0..2]);
+
+    // Copying is bounded by the output length.
+    var vals: [3]v8.Value = undefined;
+    try t.expectEqual(@as(usize, 3), try arr.copyToValues(ctx, &vals));
+    try t.expectEqual(@as(f64, 2.5), try vals[1].toF64(ctx));
+    try env.expectString("x", vals[2]);
+
+    // Elements are read with Get, so getters run and can throw.
+    var try_catch: v8.TryCatch = undefined;
+    try_catch.init(iso);
+    defer try_catch.deinit();
+    const throwing = (try env.eval("const a = [1]; Object.defineProperty(a, 1, { get() { throw 1; } }); a")).castTo(v8.Array);
+    try t.expectError(error.JsException, throwing.copyToValues(ctx, &vals));
+    try t.expect(try_catch.hasCaught());
+}
+
+test "Object.initWithProperties and batch get/set" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+    const global = ctx.getGlobal();
+
+    const names = [_]v8.String{ v8.String.initUtf8(iso, "a"), v8.String.initUtf8(iso, "b") };
+    const values = [_]v8.Value{ v8.Integer.initI32(iso, 1).toValue(), v8.Integer.initI32(iso, 2).toValue() };
+
+    const obj = v8.Object.initWithProperties(iso, v8.Object.init(iso).getPrototype(), &names, &values);
+    _ = global.setValue(ctx, v8.String.initUtf8(iso, "o"), obj);
+    try t.expect((try env.eval("Object.getPrototypeOf(o) === Object.prototype")).toBool(iso));
+    try env.expectString("a,b", try env.eval("Object.keys(o).join()"));
+    try t.expectEqual(@as(i32, 3), try (try env.eval("o.a + o.b")).toI32(ctx));
+
+    const dict = v8.Object.initWithProperties(iso, v8.initNull(iso), &names, &values);
+    _ = global.setValue(ctx, v8.String.initUtf8(iso, "d"), dict);
+    try t.expect((try env.eval("Object.getPrototypeOf(d) === null")).toBool(iso));
+    try t.expectEqual(@as(i32, 2), try (try env.eval("d.b")).toI32(ctx));
+
+    const keys = [_]v8.Value{ names[1].toValue(), names[0].toValue() };
+    try obj.setValues(ctx, &keys, &values);
+    var out: [2]v8.Value = undefined;
+    try obj.getValues(ctx, &keys, &out);
+    try t.expectEqual(@as(i32, 1), try out[0].toI32(ctx));
+    try t.expectEqual(@as(i32, 2), try out[1].toI32(ctx));
+    try t.expectEqual(@as(i32, 2), try (try env.eval("o.a")).toI32(ctx));
+}
+
+test "StringCache" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+
+    const Keys = v8.StringCache(&.{ "id", "name" });
+    var keys = Keys.init(iso);
+    defer keys.deinit();
+
+    try env.expectString("name", keys.get("name").toValue());
+
+    const obj = v8.Object.init(iso);
+    try t.expect(obj.setValue(ctx, keys.get("id"), v8.Integer.initI32(iso, 5)));
+    try t.expect(obj.setValue(ctx, keys.get("name"), v8.String.initUtf8(iso, "five")));
+    _ = ctx.getGlobal().setValue(ctx, v8.String.initUtf8(iso, "o"), obj);
+
+    try t.expectEqual(@as(i32, 5), try (try env.eval("o.id")).toI32(ctx));
+    try env.expectString("six", try (try env.eval("({ name: 'six' })")).castTo(v8.Object).getValue(ctx, keys.get("name")));
+    try t.expectEqual(@as(i32, 5), try (try obj.getValue(ctx, keys.get("id"))).toI32(ctx));
+}
+
+fn initTagged(env: TestEnv, tag: i32) v8.Object {
+    const obj = v8.Object.init(env.isolate);
+    _ = obj.setValue(env.context, v8.String.initUtf8(env.isolate, "tag"), v8.Integer.initI32(env.isolate, tag));
+    return obj;
+}
+
+fn getTag(env: TestEnv, obj: v8.Object) !i32 {
+    return (try obj.getValue(env.context, v8.String.initUtf8(env.isolate, "tag"))).toI32(env.context);
+}
+
+test "Global, GlobalSlab and Eternal" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+
+    // Handles outlive the scope they were created in.
+    var first: v8.Global(v8.Object) = undefined;
+    var second: v8.Global(v8.Object) = undefined;
+    var eternal: v8.Eternal(v8.String) = undefined;
+    {
+        var hscope: v8.HandleScope = undefined;
+        hscope.init(iso);
+        defer hscope.deinit();
+        first = v8.Global(v8.Object).init(iso, initTagged(env, 1));
+        second = v8.Global(v8.Object).init(iso, initTagged(env, 2));
+        eternal = v8.Eternal(v8.String).init(iso, v8.String.initUtf8(iso, "forever"));
+    }
+    defer first.deinit();
+    defer second.deinit();
+    iso.lowMemoryNotification();
+
+    try t.expectEqual(@as(i32, 1), try getTag(env, first.get()));
+    try env.expectString("forever", eternal.get(iso).toValue());
+
+    // Moving releases the handle dest held and leaves the source empty.
+    first.moveTo(&second);
+    try t.expectEqual(@as(i32, 1), try getTag(env, second.get()));
+    second.moveTo(&first);
+    try t.expectEqual(@as(i32, 1), try getTag(env, first.get()));
+
+    // A weak handle can be moved into a fresh slot while a local keeps its object alive.
+    {
+        var hscope: v8.HandleScope = undefined;
+        hscope.init(iso);
+        defer hscope.deinit();
+
+        const obj = initTagged(env, 4);
+        var weak = v8.Global(v8.Object).init(iso, obj);
+        weak.setWeak();
+        const slot = try t.allocator.create(v8.Global(v8.Object));
+        defer t.allocator.destroy(slot);
+        slot.initMove(&weak);
+        defer slot.deinit();
+        weak.deinit();
+
+        iso.lowMemoryNotification();
+        try t.expectEqual(@as(i32, 4), try getTag(env, slot.get()));
+        try t.expectEqual(@as(i32, 4), try getTag(env, obj));
+    }
+
+    var slab = v8.GlobalSlab(v8.Object).init(t.allocator);
+    defer slab.deinit();
+
+    // Enough handles to span more than one chunk.
+    var handles: [600]*v8.Global(v8.Object) = undefined;
+    {
+        var hscope: v8.HandleScope = undefined;
+        hscope.init(iso);
+        defer hscope.deinit();
+        for (&handles, 0..) |*handle, i| {
+            handle.* = try slab.create(iso, initTagged(env, @intCast(i)));
+        }
+    }
+    iso.lowMemoryNotification();
+    try t.expectEqual(@as(i32, 0), try getTag(env, handles[0].get()));
+    try t.expectEqual(@as(i32, 599), try getTag(env, handles[599].get()));
+
+    // A single handle can be released early, reset releases the rest and reuses the chunks.
+    handles[3].deinit();
+    slab.reset();
+    const reused = try slab.create(iso, initTagged(env, 7));
+    try t.expectEqual(handles[0], reused);
+    try t.expectEqual(@as(i32, 7), try getTag(env, reused.get()));
+}
+
+fn initTaggedMaybe(env: TestEnv, tag: ?i32) ?v8.Object {
+    return if (tag) |val| initTagged(env, val) else null;
+}
+
+fn evalObject(env: TestEnv, src: []const u8) !v8.Object {
+    return (try env.eval(src)).castTo(v8.Object);
+}
+
+fn sumTags(env: TestEnv) !i32 {
+    var sum: i32 = 0;
+    for (0..4) |i| {
+        sum += try getTag(env, initTagged(env, @intCast(i)));
+    }
+    return sum;
+}
+
+test "HandleScope.run and EscapableHandleScope.run" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+
+    try t.expectEqual(@as(i32, 6), try v8.HandleScope.run(iso, sumTags, .{env}));
+
+    // Escaped handles stay valid after the nested scope is closed and a GC has run.
+    const obj = v8.EscapableHandleScope.run(iso, initTagged, .{ env, 1 });
+    const maybe = v8.EscapableHandleScope.run(iso, initTaggedMaybe, .{ env, 2 });
+    const none = v8.EscapableHandleScope.run(iso, initTaggedMaybe, .{ env, null });
+    const evaled = try v8.EscapableHandleScope.run(iso, evalObject, .{ env, "({ tag: 3 })" });
+    iso.lowMemoryNotification();
+
+    try t.expectEqual(@as(i32, 1), try getTag(env, obj));
+    try t.expectEqual(@as(i32, 2), try getTag(env, maybe.?));
+    try t.expect(none == null);
+    try t.expectEqual(@as(i32, 3), try getTag(env, evaled));
+
+    // Errors are passed through without escaping anything.
+    var try_catch: v8.TryCatch = undefined;
+    try_catch.init(iso);
+    defer try_catch.deinit();
+    try t.expectError(error.JsException, v8.EscapableHandleScope.run(iso, evalObject, .{ env, "throw 1" }));
+}
+
+var node_finalizes: u32 = 0;
+
+const Node = struct {
+    value: i32,
+    next: v8.GcMember,
+    js: v8.TracedReference(v8.Object),
+
+    pub fn trace(self: *const Node, visitor: v8.CppgcVisitor) void {
+        visitor.traceMember(&self.next);
+        visitor.traceReference(v8.Object, &self.js);
+    }
+
+    pub fn finalize(_: *Node) void {
+        node_finalizes += 1;
+    }
+};
+
+fn initNode(heap: v8.CppHeap, value: i32) v8.GcObject(Node) {
+    return v8.GcObject(Node).create(heap, .{
+        .value = value,
+        .next = v8.GcMember.empty,
+        .js = v8.TracedReference(v8.Object).empty,
+    });
+}
+
+test "GcObject, GcMember and TracedReference" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+
+    const tmpl = v8.ObjectTemplate.initDefault(iso);
+    tmpl.setInternalFieldCount(2);
+
+    node_finalizes = 0;
+    {
+        const heap = v8.CppHeap.init(initTestPlatform());
+        iso.attachCppHeap(heap);
+        defer {
+            iso.detachCppHeap();
+            heap.terminate();
+            heap.deinit();
+        }
+
+        // head is only reachable from the JS wrapper, tail from head and the JS object from tail.
+        {
+            var hscope: v8.HandleScope = undefined;
+            hscope.init(iso);
+            defer hscope.deinit();
+
+            const head = initNode(heap, 1);
+            const tail = initNode(heap, 2);
+            head.get().next.set(tail);
+            tail.get().js.set(iso, initTagged(env, 3));
+            try t.expectEqual(head.handle, v8.GcObject(Node).fromPtr(head.get()).handle);
+
+            const wrapper = tmpl.initInstance(ctx);
+            head.wrap(wrapper);
+            _ = ctx.getGlobal().setValue(ctx, v8.String.initUtf8(iso, "w"), wrapper);
+        }
+        iso.lowMemoryNotification();
+
+        const head = v8.GcObject(Node).unwrap((try env.eval("w")).castTo(v8.Object));
+        try t.expectEqual(@as(i32, 1), head.get().value);
+        const tail = head.get().next.get(Node).?;
+        try t.expectEqual(@as(i32, 2), tail.get().value);
+        try t.expect(tail.get().next.get(Node) == null);
+        try t.expect(head.get().js.isEmpty());
+        try t.expectEqual(@as(i32, 3), try getTag(env, tail.get().js.get(iso).?));
+
+        tail.get().js.reset();
+        try t.expect(tail.get().js.get(iso) == null);
+        head.get().next.clear();
+        try t.expect(head.get().next.get(Node) == null);
+    }
+    // Terminating the heap reclaims every object, including the ones that were still referenced.
+    try t.expectEqual(@as(u32, 2), node_finalizes);
+}
+
+test "SnapshotCreator and SnapshotContextFactory" {
+    _ = initTestPlatform();
+
+    var context_index: usize = undefined;
+    var blob = blk: {
+        const creator = v8.SnapshotCreator.init(null, null);
+        defer creator.deinit();
+        const iso = creator.getIsolate();
+        {
+            var hscope: v8.HandleScope = undefined;
+            hscope.init(iso);
+            defer hscope.deinit();
+
+            creator.setDefaultContext(v8.Context.init(iso, null, null));
+
+            const ctx = v8.Context.init(iso, null, null);
+            ctx.enter();
+            defer ctx.exit();
+            _ = try evalIn(ctx, "globalThis.answer = 21; function double(x) { return x * 2; }");
+            context_index = creator.addContext(ctx);
+        }
+        break :blk try creator.createBlob(.kClear);
+    };
+    defer blob.deinit();
+    try t.expect(blob.getData().len > 0);
+
+    var params = v8.initCreateParams();
+    params.array_buffer_allocator = v8.createDefaultArrayBufferAllocator();
+    defer v8.destroyArrayBufferAllocator(params.array_buffer_allocator.?);
+    params.snapshot_blob = blob.getStartupData();
+
+    var iso = v8.Isolate.init(&params);
+    defer iso.deinit();
+    iso.enter();
+    defer iso.exit();
+
+    var hscope: v8.HandleScope = undefined;
+    hscope.init(iso);
+    defer hscope.deinit();
+
+    const factory = v8.SnapshotContextFactory.init(iso, context_index, null);
+    {
+        const ctx = try factory.create();
+        ctx.enter();
+        defer ctx.exit();
+        try t.expectEqual(@as(i32, 42), try (try evalIn(ctx, "double(answer)")).toI32(ctx));
+        _ = try evalIn(ctx, "answer = 1");
+    }
+    factory.notifyDisposed();
+
+    // Every context starts from the snapshotted state.
+    const ctx = try factory.create();
+    ctx.enter();
+    defer ctx.exit();
+    try t.expectEqual(@as(i32, 21), try (try evalIn(ctx, "answer")).toI32(ctx));
+}
+
+/// Compiles and runs src in a fresh isolate and returns its code cache, so consuming it isn't short-circuited by
+/// the isolate's own compilation cache.
+fn createScriptCodeCache(src: []const u8) ![]u8 {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const res = try v8.ScriptCompiler.compileWithCodeCache(env.isolate, v8.String.initUtf8(env.isolate, src), null, null);
+    try t.expect(!res.cache_accepted);
+    _ = try res.script.bindToCurrentContext().run(env.context);
+    const cache = res.script.createCodeCache() orelse return error.NoCodeCache;
+    defer cache.deinit();
+    return t.allocator.dupe(u8, cache.getData());
+}
+
+test "ScriptCompiler.compileWithCodeCache" {
+    const src = "function add(a, b) { return a + b; } add(1, 2)";
+    const cache = try createScriptCodeCache(src);
+    defer t.allocator.free(cache);
+
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+
+    const res = try v8.ScriptCompiler.compileWithCodeCache(iso, v8.String.initUtf8(iso, src), null, cache);
+    try t.expect(res.cache_accepted);
+    try t.expectEqual(@as(i32, 3), try (try res.script.bindToCurrentContext().run(ctx)).toI32(ctx));
+
+    // V8 checks the source length, so a modified source of a different length rejects the cache and compiles normally.
+    const changed = try v8.ScriptCompiler.compileWithCodeCache(iso, v8.String.initUtf8(iso, "function add(a, b) { return a + b; } add(1, 20)"), null, cache);
+    try t.expect(!changed.cache_accepted);
+    try t.expectEqual(@as(i32, 21), try (try changed.script.bindToCurrentContext().run(ctx)).toI32(ctx));
+}
+
+fn initParams(iso: v8.Isolate) [2]v8.String {
+    return .{ v8.String.initUtf8(iso, "a"), v8.String.initUtf8(iso, "b") };
+}
+
+fn callWith(ctx: v8.Context, func: v8.Function, a: i32, b: i32) !i32 {
+    const iso = ctx.getIsolate();
+    const args = [_]v8.Value{ v8.Integer.initI32(iso, a).toValue(), v8.Integer.initI32(iso, b).toValue() };
+    const res = func.call(ctx, ctx.getGlobal(), &args) orelse return error.JsException;
+    return res.toI32(ctx);
+}
+
+/// Same as createScriptCodeCache for a function body compiled with the params a and b.
+fn createFunctionCodeCache(body: []const u8) ![]u8 {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const params = initParams(env.isolate);
+    const res = try v8.ScriptCompiler.compileFunctionWithCodeCache(env.context, v8.String.initUtf8(env.isolate, body), null, &params, null);
+    try t.expect(!res.cache_accepted);
+    _ = try callWith(env.context, res.func, 1, 2);
+    const cache = v8.ScriptCompiler.createCodeCacheForFunction(res.func) orelse return error.NoCodeCache;
+    defer cache.deinit();
+    return t.allocator.dupe(u8, cache.getData());
+}
+
+test "ScriptCompiler.compileFunction" {
+    const body = "return a * 10 + b;";
+    const cache = try createFunctionCodeCache(body);
+    defer t.allocator.free(cache);
+
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const iso = env.isolate;
+    const ctx = env.context;
+    const params = initParams(iso);
+
+    const res = try v8.ScriptCompiler.compileFunctionWithCodeCache(ctx, v8.String.initUtf8(iso, body), null, &params, cache);
+    try t.expect(res.cache_accepted);
+    try t.expectEqual(@as(i32, 12), try callWith(ctx, res.func, 1, 2));
+
+    const changed = try v8.ScriptCompiler.compileFunctionWithCodeCache(ctx, v8.String.initUtf8(iso, "return a * 100 + b;"), null, &params, cache);
+    try t.expect(!changed.cache_accepted);
+    try t.expectEqual(@as(i32, 102), try callWith(ctx, changed.func, 1, 2));
+
+    // Free variables resolve against the context extensions first.
+    const ext = v8.Object.init(iso);
+    _ = ext.setValue(ctx, v8.String.initUtf8(iso, "base"), v8.Integer.initI32(iso, 1000));
+    var source: v8.ScriptCompilerSource = undefined;
+    source.init(v8.String.initUtf8(iso, "return base + a + b;"), null, null);
+    defer source.deinit();
+    const func = try v8.ScriptCompiler.compileFunction(ctx, &source, &params, &.{ext}, .kNoCompileOptions, .kNoCacheNoReason);
+    try t.expectEqual(@as(i32, 1003), try callWith(ctx, func, 1, 2));
+}
+
+test "memory pressure, RAIL mode and idle tasks" {
+    var env: TestEnv = undefined;
+    env.init();
+    defer env.deinit();
+
+    const platform = initTestPlatform();
+    const iso = env.isolate;
+    const ctx = env.context;
+
+    _ = try env.eval("globalThis.garbage = []; for (let i = 0; i < 10000; i++) garbage.push({ i }); garbage = null");
+
+    iso.setIsLoading(true);
+    iso.memoryPressureNotification(.kModerate);
+    iso.setIsLoading(false);
+    iso.setRAILMode(.PERFORMANCE_IDLE);
+    try t.expect(platform.runIdleTasksUntil(iso, platform.monotonicallyIncreasingTime() + 0.01));
+    try t.expect(!platform.runIdleTasksUntil(iso, platform.monotonicallyIncreasingTime() - 1));
+    iso.memoryPressureNotification(.kCritical);
+    iso.memoryPressureNotification(.kNone);
+    iso.setRAILMode(.PERFORMANCE_ANIMATION);
+
+    try t.expectEqual(@as(i32, 3), try (try env.eval("[1, 2].reduce((a, b) => a + b)")).toI32(ctx));
+}
+
 pub fn valueToRawUtf8Alloc(alloc: std.mem.Allocator, isolate: v8.Isolate, ctx: v8.Context, val: v8.Value) []const u8 {
     const str = val.toString(ctx) catch unreachable;
     const len = str.lenUtf8(isolate);
@@ -10,6 +10,40 @@ pub const PropertyAttribute = struct {
     pub const ReadOnly = c.ReadOnly;
 };
 
+/// [V8]
+/// Configuration flags for v8::NamedPropertyHandlerConfiguration.
+pub const PropertyHandlerFlags = struct {
+    /// None.
+    pub const kNone = c.kNone;
+    pub const kAllCanRead = c.kAllCanRead;
+    /// Will not call into interceptor for properties on the receiver or prototype
+    /// chain, i.e., only call into interceptor for properties that do not exist.
+    /// Currently only valid for named interceptors.
+    pub const kNonMasking = c.kNonMasking;
+    /// Will not call into interceptor for symbol lookup.  Only meaningful for
+    /// named interceptors.
+    pub const kOnlyInterceptStrings = c.kOnlyInterceptStrings;
+    /// The getter, query, enumerator callbacks do not produce side effects.
+    pub const kHasNoSideEffect = c.kHasNoSideEffect;
+};
+
+/// [V8]
+/// Reported by the AtomicsWaitCallback.
+pub const AtomicsWaitEvent = struct {
+    /// Indicates that this call is happening before waiting.
+    pub const kStartWait = c.kStartWait;
+    /// `Atomics.wait()` finished because of an `Atomics.wake()` call.
+    pub const kWokenUp = c.kWokenUp;
+    /// `Atomics.wait()` finished because it timed out.
+    pub const kTimedOut = c.kTimedOut;
+    /// `Atomics.wait()` was interrupted through |TerminateExecution()|.
+    pub const kTerminatedExecution = c.kTerminatedExecution;
+    /// `Atomics.wait()` was stopped through |AtomicsWaitWakeHandle|.
+    pub const kAPIStopped = c.kAPIStopped;
+    /// `Atomics.wait()` did not wait, as the initial condition was not met.
+    pub const kNotEqual = c.kNotEqual;
+};
+
 pub const PromiseRejectEvent = struct {
     pub const kPromiseRejectWithNoHandler = c.kPromiseRejectWithNoHandler;
     pub const kPromiseHandlerAddedAfterReject = c.kPromiseHandlerAddedAfterReject;
@@ -38,6 +72,103 @@ pub const MicrotasksPolicy = struct {
     pub const kAuto = c.kAuto;
 };
 
+/// [V8]
+/// Memory pressure level for the MemoryPressureNotification.
+/// kNone hints V8 that there is no memory pressure.
+/// kModerate hints V8 to speed up incremental garbage collection at the cost of
+/// of higher latency due to garbage collection pauses.
+/// kCritical hints V8 to free memory as soon as possible. Garbage collection
+/// pauses at this level will be large.
+pub const MemoryPressureLevel = enum(u32) {
+    kNone = c.kMemoryPressureNone,
+    kModerate = c.kMemoryPressureModerate,
+    kCritical = c.kMemoryPressureCritical,
+};
+
+/// [V8]
+/// Option flags passed to the SetRAILMode function.
+pub const RAILMode = enum(u32) {
+    /// Response performance mode: In this mode very low virtual machine latency
+    /// is provided. V8 will try to avoid JavaScript execution interruptions.
+    /// Throughput may be throttled.
+    PERFORMANCE_RESPONSE = c.PERFORMANCE_RESPONSE,
+    /// Animation performance mode: In this mode low virtual machine latency is
+    /// provided. V8 will try to avoid as many JavaScript execution interruptions
+    /// as possible. Throughput may be throttled. This is the default mode.
+    PERFORMANCE_ANIMATION = c.PERFORMANCE_ANIMATION,
+    /// Idle performance mode: The embedder is idle. V8 can complete deferred work
+    /// in this mode.
+    PERFORMANCE_IDLE = c.PERFORMANCE_IDLE,
+    /// Load performance mode: In this mode high throughput is provided. V8 may
+    /// turn off latency optimizations.
+    PERFORMANCE_LOAD = c.PERFORMANCE_LOAD,
+};
+
+pub const MicrotasksScopeType = struct {
+    pub const kRunMicrotasks = c.kRunMicrotasks;
+    pub const kDoNotRunMicrotasks = c.kDoNotRunMicrotasks;
+};
+
+pub const MicrotaskCallback = c.MicrotaskCallback;
+
+/// [V8]
+/// Represents the microtask queue, where microtasks are stored and processed.
+/// https://html.spec.whatwg.org/multipage/webappapis.html#microtask-queue
+/// https://html.spec.whatwg.org/multipage/webappapis.html#enqueuejob(queuename,-job,-arguments)
+/// https://html.spec.whatwg.org/multipage/webappapis.html#perform-a-microtask-checkpoint
+///
+/// A MicrotaskQueue instance may be associated to multiple Contexts by passing
+/// it to Context::New(), and they can be detached by Context::DetachGlobal().
+/// The embedder must keep the MicrotaskQueue instance alive until all associated
+/// Contexts are gone or detached.
+/// [Notes]
+/// Giving each tenant context its own queue (see Context.initWithQueue) lets it be drained independently,
+/// so a burst of promise jobs in one context doesn't delay checkpoints in another.
+pub const MicrotaskQueue = struct {
+    const Self = @This();
+
+    handle: *c.MicrotaskQueue,
+
+    pub fn init(isolate: Isolate, policy: c.MicrotasksPolicy) Self {
+        return .{
+            .handle = c.v8__MicrotaskQueue__New(isolate.handle, policy).?,
+        };
+    }
+
+    pub fn deinit(self: Self) void {
+        c.v8__MicrotaskQueue__DELETE(self.handle);
+    }
+
+    /// [V8]
+    /// Enqueues the callback to the queue.
+    pub fn enqueueMicrotask(self: Self, isolate: Isolate, microtask: Function) void {
+        c.v8__MicrotaskQueue__EnqueueMicrotask(self.handle, isolate.handle, microtask.handle);
+    }
+
+    /// Enqueues a native continuation without allocating a JS function.
+    pub fn enqueueMicrotaskCallback(self: Self, isolate: Isolate, callback: MicrotaskCallback, data: ?*anyopaque) void {
+        c.v8__MicrotaskQueue__EnqueueMicrotask__CALLBACK(self.handle, isolate.handle, callback, data);
+    }
+
+    /// [V8]
+    /// Runs microtasks if no microtask is running on this MicrotaskQueue instance.
+    pub fn performCheckpoint(self: Self, isolate: Isolate) void {
+        c.v8__MicrotaskQueue__PerformCheckpoint(self.handle, isolate.handle);
+    }
+
+    /// [V8]
+    /// Returns true if a microtask is running on this MicrotaskQueue instance.
+    pub fn isRunningMicrotasks(self: Self) bool {
+        return c.v8__MicrotaskQueue__IsRunningMicrotasks(self.handle);
+    }
+
+    /// [V8]
+    /// Returns the current depth of nested MicrotasksScope that has kRunMicrotasks.
+    pub fn getMicrotasksScopeDepth(self: Self) u32 {
+        return @intCast(c.v8__MicrotaskQueue__GetMicrotasksScopeDepth(self.handle));
+    }
+};
+
 // Currently, user callback functions passed into FunctionTemplate will need to have this declared as a param and then
 // converted to FunctionCallbackInfo to get a nicer interface.
 pub const C_FunctionCallbackInfo = c.FunctionCallbackInfo;
@@ -51,6 +182,7 @@ pub const C_Context = c.Context;
 pub const C_Data = c.Data;
 pub const C_FixedArray = c.FixedArray;
 pub const C_Module = c.Module;
+pub const C_CreateParams = c.CreateParams;
 pub const C_InternalAddress = c.InternalAddress;
 
 pub const MessageCallback = c.MessageCallback;
@@ -102,6 +234,40 @@ pub const Platform = struct {
     pub fn pumpMessageLoop(self: Self, isolate: Isolate, wait_for_work: bool) bool {
         return c.v8__Platform__PumpMessageLoop(self.handle, isolate.handle, wait_for_work);
     }
+
+    /// [V8]
+    /// Runs pending idle tasks for at most |idle_time_in_seconds| seconds.
+    ///
+    /// The caller has to make sure that this is called from the right thread.
+    /// This call does not block if no task is pending. The |platform| has to be
+    /// created using |NewDefaultPlatform|.
+    /// [Notes]
+    /// Idle tasks are only posted when the platform was created with idle_task_support.
+    /// V8 uses them for incremental marking steps and heap shrinking.
+    pub fn runIdleTasks(self: Self, isolate: Isolate, idle_time_in_seconds: f64) void {
+        c.v8__Platform__RunIdleTasks(self.handle, isolate.handle, idle_time_in_seconds);
+    }
+
+    /// Runs idle tasks until the deadline, in seconds on the monotonicallyIncreasingTime clock. Returns false if
+    /// the deadline has already passed. Use it to hand the gap before the next expected request to the GC.
+    pub fn runIdleTasksUntil(self: Self, isolate: Isolate, deadline_in_seconds: f64) bool {
+        const remaining = deadline_in_seconds - self.monotonicallyIncreasingTime();
+        if (remaining <= 0) {
+            return false;
+        }
+        self.runIdleTasks(isolate, remaining);
+        return true;
+    }
+
+    /// [V8]
+    /// Monotonically increasing time in seconds from an arbitrary fixed point in
+    /// the past. This function is expected to return at least
+    /// millisecond-precision values. For this reason,
+    /// it is recommended that the fixed point be no further in the past than
+    /// the epoch.
+    pub fn monotonicallyIncreasingTime(self: Self) f64 {
+        return c.v8__Platform__MonotonicallyIncreasingTime(self.handle);
+    }
 };
 
 pub fn getVersion() []const u8 {
@@ -117,6 +283,42 @@ pub fn initV8Platform(platform: Platform) void {
     c.v8__V8__InitializePlatform(platform.handle);
 }
 
+/// [v8]
+/// Initialize the external startup data. The embedder only needs to
+/// invoke this method when external startup data was enabled in a build.
+///
+/// This will look in the given directory for the file "snapshot_blob.bin".
+/// [Notes]
+/// Only needed for libs built with -Duse-external-startup-data=true. Call before initV8.
+/// The blob is written to the lib's ninja out dir, eg. v8-build/<target>/release/ninja/snapshot_blob.bin.
+pub fn initV8ExternalStartupData(directory_path: [:0]const u8) void {
+    c.v8__V8__InitializeExternalStartupData(directory_path.ptr);
+}
+
+/// [v8]
+/// As initV8ExternalStartupData, but will directly use the given file name.
+pub fn initV8ExternalStartupDataFromFile(snapshot_blob: [:0]const u8) void {
+    c.v8__V8__InitializeExternalStartupDataFromFile(snapshot_blob.ptr);
+}
+
+/// [v8]
+/// Hand startup data to V8, in case the embedder has chosen to build
+/// V8 with external startup data.
+///
+/// Note:
+/// - By default the startup data is linked into the V8 library, in which
+///   case this function is not meaningful.
+/// - If this needs to be called, it needs to be called before V8
+///   tries to make use of its built-ins.
+/// - To avoid unnecessary copies of data, V8 will point directly into the
+///   given data blob, so pretty please keep it around until V8 exit.
+/// - Compression of the startup blob might be useful, but needs to
+///   handled entirely on the embedders' side.
+/// - The call will abort if the data is invalid.
+pub fn setV8SnapshotDataBlob(blob: *SnapshotBlob) void {
+    c.v8__V8__SetSnapshotDataBlob(blob.getStartupData());
+}
+
 /// [v8]
 /// Initializes V8. This function needs to be called before the first Isolate
 /// is created. It always returns true.
@@ -280,6 +482,16 @@ pub const Isolate = struct {
         c.v8__Isolate__PerformMicrotaskCheckpoint(self.handle);
     }
 
+    /// [V8]
+    /// Enqueues the callback to the default MicrotaskQueue
+    pub fn enqueueMicrotask(self: Self, microtask: Function) void {
+        c.v8__Isolate__EnqueueMicrotask(self.handle, microtask.handle);
+    }
+
+    pub fn enqueueMicrotaskCallback(self: Self, callback: MicrotaskCallback, data: ?*anyopaque) void {
+        c.v8__Isolate__EnqueueMicrotask__CALLBACK(self.handle, callback, data);
+    }
+
     pub fn addMessageListener(self: Self, callback: c.MessageCallback) bool {
         return c.v8__Isolate__AddMessageListener(self.handle, callback);
     }
@@ -312,6 +524,99 @@ pub const Isolate = struct {
         c.v8__Isolate__LowMemoryNotification(self.handle);
     }
 
+    /// [V8]
+    /// Optional notification that the system is running low on memory.
+    /// V8 uses these notifications to guide heuristics.
+    /// It is allowed to call this function from another thread while
+    /// the isolate is executing long running JavaScript code.
+    /// [Notes]
+    /// Unlike lowMemoryNotification, kModerate speeds up incremental marking without a blocking full GC.
+    pub fn memoryPressureNotification(self: Self, level: MemoryPressureLevel) void {
+        c.v8__Isolate__MemoryPressureNotification(self.handle, @intCast(@intFromEnum(level)));
+    }
+
+    /// [V8]
+    /// Optional notification that the isolate switched to the background.
+    /// V8 uses these notifications to guide heuristics.
+    pub fn inBackgroundNotification(self: Self) void {
+        c.v8__Isolate__IsolateInBackgroundNotification(self.handle);
+    }
+
+    /// [V8]
+    /// Optional notification that the isolate switched to the foreground.
+    /// V8 uses these notifications to guide heuristics.
+    pub fn inForegroundNotification(self: Self) void {
+        c.v8__Isolate__IsolateInForegroundNotification(self.handle);
+    }
+
+    /// [V8]
+    /// Optional notification to tell V8 the current performance requirements
+    /// of the embedder based on RAIL.
+    /// V8 uses these notifications to guide heuristics.
+    /// This is an unfinished experimental feature. Semantics and implementation
+    /// may change frequently.
+    pub fn setRAILMode(self: Self, rail_mode: RAILMode) void {
+        c.v8__Isolate__SetRAILMode(self.handle, @intCast(@intFromEnum(rail_mode)));
+    }
+
+    /// While loading, V8 favors throughput and defers GC work. Maps to PERFORMANCE_LOAD and back to the default
+    /// PERFORMANCE_ANIMATION.
+    pub fn setIsLoading(self: Self, is_loading: bool) void {
+        self.setRAILMode(if (is_loading) .PERFORMANCE_LOAD else .PERFORMANCE_ANIMATION);
+    }
+
+    /// [V8]
+    /// Optional notification that a context has been disposed. V8 uses these
+    /// notifications to guide the GC heuristic and cancel FinalizationRegistry
+    /// cleanup tasks. Returns the number of context disposals - including this
+    /// one - since the last time V8 had a chance to clean up.
+    ///
+    /// The optional parameter |dependant_context| specifies whether the disposed
+    /// context was depending on state from other contexts or not.
+    pub fn contextDisposedNotification(self: Self, dependant_context: bool) u32 {
+        return @intCast(c.v8__Isolate__ContextDisposedNotification(self.handle, dependant_context));
+    }
+
+    /// [V8]
+    /// Sets the callback that is invoked by WebAssembly.compileStreaming and WebAssembly.instantiateStreaming.
+    /// [Notes]
+    /// The callback's data value holds the WasmStreaming (see WasmStreaming.unpack) and the first arg is the
+    /// source that was passed to compileStreaming.
+    pub fn setWasmStreamingCallback(self: Self, callback: c.FunctionCallback) void {
+        c.v8__Isolate__SetWasmStreamingCallback(self.handle, callback);
+    }
+
+    /// [V8]
+    /// Set a callback that will be called just before and after each
+    /// `Atomics.wait()` call, e.g. to put the worker thread into a blocking state the embedder can wake it from.
+    /// [Notes]
+    /// The callback's stop_handle can be wrapped with AtomicsWaitWakeHandle to interrupt the wait from another thread.
+    pub fn setAtomicsWaitCallback(self: Self, callback: c.AtomicsWaitCallback, data: ?*anyopaque) void {
+        c.v8__Isolate__SetAtomicsWaitCallback(self.handle, callback, data);
+    }
+
+    /// [V8]
+    /// Attaches a managed C++ heap as an extension to the JavaScript heap. The
+    /// embedder maintains ownership of the CppHeap. At most one C++ heap can be
+    /// attached to V8.
+    pub fn attachCppHeap(self: Self, heap: CppHeap) void {
+        c.v8__Isolate__AttachCppHeap(self.handle, heap.handle);
+    }
+
+    /// [V8]
+    /// Detaches a managed C++ heap if one was attached using `AttachCppHeap()`.
+    pub fn detachCppHeap(self: Self) void {
+        c.v8__Isolate__DetachCppHeap(self.handle);
+    }
+
+    pub fn getCppHeap(self: Self) ?CppHeap {
+        if (c.v8__Isolate__GetCppHeap(self.handle)) |handle| {
+            return CppHeap{
+                .handle = handle,
+            };
+        } else return null;
+    }
+
     pub fn getHeapStatistics(self: Self) c.HeapStatistics {
         var res: c.HeapStatistics = undefined;
         c.v8__Isolate__GetHeapStatistics(self.handle, &res);
@@ -429,8 +734,126 @@ pub const HandleScope = struct {
     pub fn deinit(self: *Self) void {
         c.v8__HandleScope__DESTRUCT(&self.inner);
     }
+
+    /// Calls func with args in a nested HandleScope, so handles created by func are freed as soon as it returns.
+    /// The result must not contain handles, use EscapableHandleScope.run for that.
+    pub fn run(isolate: Isolate, comptime func: anytype, args: anytype) ReturnTypeOf(func) {
+        var scope: Self = undefined;
+        scope.init(isolate);
+        defer scope.deinit();
+        return @call(.auto, func, args);
+    }
+};
+
+/// [V8]
+/// A HandleScope which first allocates a handle in the current scope
+/// which will be later filled with the escape value.
+pub const EscapableHandleScope = struct {
+    const Self = @This();
+
+    inner: c.EscapableHandleScope,
+
+    /// Like HandleScope.init, this should construct in place.
+    pub fn init(self: *Self, isolate: Isolate) void {
+        c.v8__EscapableHandleScope__CONSTRUCT(&self.inner, isolate.handle);
+    }
+
+    pub fn deinit(self: *Self) void {
+        c.v8__EscapableHandleScope__DESTRUCT(&self.inner);
+    }
+
+    /// [V8]
+    /// Pushes the value into the previous scope and returns a handle to it.
+    /// Cannot be called twice.
+    pub fn escape(self: *Self, value: anytype) @TypeOf(value) {
+        const handle: *const c.Data = @ptrCast(value.handle);
+        return .{
+            .handle = @ptrCast(c.v8__EscapableHandleScope__Escape(&self.inner, handle).?),
+        };
+    }
+
+    /// Calls func with args in a nested scope and escapes the returned handle into the caller's scope.
+    /// func can return a handle, an optional handle or an error union of a handle.
+    pub fn run(isolate: Isolate, comptime func: anytype, args: anytype) ReturnTypeOf(func) {
+        var scope: Self = undefined;
+        scope.init(isolate);
+        defer scope.deinit();
+        const res = @call(.auto, func, args);
+        switch (@typeInfo(@TypeOf(res))) {
+            .ErrorUnion => return scope.escape(try res),
+            .Optional => return if (res) |val| scope.escape(val) else null,
+            else => return scope.escape(res),
+        }
+    }
+};
+
+/// [V8]
+/// A SealHandleScope acts like a handle scope in which no handle allocations
+/// are allowed. It can be useful for debugging handle leaks.
+/// Handles can be allocated within inner normal HandleScopes.
+pub const SealHandleScope = struct {
+    const Self = @This();
+
+    inner: c.SealHandleScope,
+
+    /// Like HandleScope.init, this should construct in place.
+    pub fn init(self: *Self, isolate: Isolate) void {
+        c.v8__SealHandleScope__CONSTRUCT(&self.inner, isolate.handle);
+    }
+
+    pub fn deinit(self: *Self) void {
+        c.v8__SealHandleScope__DESTRUCT(&self.inner);
+    }
+};
+
+/// [V8]
+/// This scope is used to control microtasks when MicrotasksPolicy::kScoped
+/// is used on Isolate. In this mode every non-primitive call to V8 should be
+/// done inside some MicrotasksScope.
+/// Microtasks are executed when topmost MicrotasksScope marked as kRunMicrotasks
+/// exits.
+/// kDoNotRunMicrotasks should be used to annotate calls not intended to trigger
+/// microtasks.
+pub const MicrotasksScope = struct {
+    const Self = @This();
+
+    inner: c.MicrotasksScope,
+
+    /// Like HandleScope.init, this should construct in place.
+    /// The scope runs against the context's own MicrotaskQueue.
+    pub fn init(self: *Self, ctx: Context, scope_type: c.MicrotasksScopeType) void {
+        c.v8__MicrotasksScope__CONSTRUCT(&self.inner, ctx.handle, scope_type);
+    }
+
+    pub fn deinit(self: *Self) void {
+        c.v8__MicrotasksScope__DESTRUCT(&self.inner);
+    }
+
+    /// [V8]
+    /// Runs microtasks if no kRunMicrotasks scope is currently active.
+    /// [Notes]
+    /// Only runs the isolate's default queue. For contexts created with initWithQueue, use MicrotaskQueue.performCheckpoint.
+    pub fn performCheckpoint(isolate: Isolate) void {
+        c.v8__MicrotasksScope__PerformCheckpoint(isolate.handle);
+    }
+
+    /// [V8]
+    /// Returns current depth of nested kRunMicrotasks scopes.
+    pub fn getCurrentDepth(isolate: Isolate) u32 {
+        return @intCast(c.v8__MicrotasksScope__GetCurrentDepth(isolate.handle));
+    }
+
+    /// [V8]
+    /// Returns true while microtasks are being executed.
+    pub fn isRunningMicrotasks(isolate: Isolate) bool {
+        return c.v8__MicrotasksScope__IsRunningMicrotasks(isolate.handle);
+    }
 };
 
+fn ReturnTypeOf(comptime func: anytype) type {
+    return @typeInfo(@TypeOf(func)).Fn.return_type.?;
+}
+
 pub const Context = struct {
     const Self = @This();
 
@@ -459,6 +882,40 @@ pub const Context = struct {
         };
     }
 
+    /// Creates a context whose microtasks are enqueued to and drained from queue instead of the isolate's default queue.
+    /// queue must outlive the context.
+    pub fn initWithQueue(isolate: Isolate, global_tmpl: ?ObjectTemplate, global_obj: ?*c.Value, queue: MicrotaskQueue) Self {
+        return .{
+            .handle = c.v8__Context__New__QUEUE(isolate.handle, if (global_tmpl != null) global_tmpl.?.handle else null, global_obj, queue.handle).?,
+        };
+    }
+
+    /// [V8]
+    /// Create a new context from a (non-default) context snapshot. There
+    /// is no way to provide a global object template since we do not create
+    /// a new global object from template, but we can reuse a global object.
+    ///
+    /// \param isolate See v8::Context::New.
+    ///
+    /// \param context_snapshot_index The index of the context snapshot to
+    /// deserialize from. Use v8::Context::New for the default snapshot.
+    /// [Notes]
+    /// The isolate must have been created with the snapshot blob (CreateParams.snapshot_blob) that holds the context.
+    pub fn initFromSnapshot(isolate: Isolate, context_snapshot_index: usize, queue: ?MicrotaskQueue) !Self {
+        if (c.v8__Context__FromSnapshot(isolate.handle, context_snapshot_index, if (queue) |q| q.handle else null)) |handle| {
+            return Self{
+                .handle = handle,
+            };
+        } else return error.JsException;
+    }
+
+    /// Returns the context's MicrotaskQueue, which is the isolate's default queue unless one was given at creation.
+    pub fn getMicrotaskQueue(self: Self) MicrotaskQueue {
+        return .{
+            .handle = c.v8__Context__GetMicrotaskQueue(self.handle).?,
+        };
+    }
+
     /// [V8]
     /// Enter this context.  After entering a context, all code compiled
     /// and run is compiled and run in this context.  If another context
@@ -531,6 +988,14 @@ pub const PropertyCallbackInfo = struct {
         };
     }
 
+    /// [V8]
+    /// The object in the prototype chain of the receiver that has the interceptor or accessor.
+    pub fn getHolder(self: Self) Object {
+        return .{
+            .handle = c.v8__PropertyCallbackInfo__Holder(self.handle).?,
+        };
+    }
+
     pub fn getData(self: Self) Value {
         return .{
             .handle = c.v8__PropertyCallbackInfo__Data(self.handle).?,
@@ -653,8 +1118,62 @@ pub const ReturnValue = struct {
 
     inner: c.ReturnValue,
 
+    /// Primitives are dispatched at comptime to the setters below, which don't create a handle.
+    /// Any other value must be a v8::Value subtype.
     pub fn set(self: Self, value: anytype) void {
-        c.v8__ReturnValue__Set(self.inner, getValueHandle(value));
+        const V = @TypeOf(value);
+        switch (@typeInfo(V)) {
+            .Bool => self.setBool(value),
+            .Int => |info| {
+                if (info.bits <= 32) {
+                    if (info.signedness == .signed) {
+                        self.setI32(value);
+                    } else {
+                        self.setU32(value);
+                    }
+                } else {
+                    self.setF64(@floatFromInt(value));
+                }
+            },
+            .ComptimeInt => {
+                if (value >= std.math.minInt(i32) and value <= std.math.maxInt(i32)) {
+                    self.setI32(value);
+                } else {
+                    self.setF64(value);
+                }
+            },
+            .Float, .ComptimeFloat => self.setF64(@floatCast(value)),
+            .Null => self.setNull(),
+            else => c.v8__ReturnValue__Set(self.inner, getValueHandle(value)),
+        }
+    }
+
+    pub fn setI32(self: Self, value: i32) void {
+        c.v8__ReturnValue__SetInt32(self.inner, value);
+    }
+
+    pub fn setU32(self: Self, value: u32) void {
+        c.v8__ReturnValue__SetUint32(self.inner, value);
+    }
+
+    pub fn setF64(self: Self, value: f64) void {
+        c.v8__ReturnValue__SetDouble(self.inner, value);
+    }
+
+    pub fn setBool(self: Self, value: bool) void {
+        c.v8__ReturnValue__SetBool(self.inner, value);
+    }
+
+    pub fn setNull(self: Self) void {
+        c.v8__ReturnValue__SetNull(self.inner);
+    }
+
+    pub fn setUndefined(self: Self) void {
+        c.v8__ReturnValue__SetUndefined(self.inner);
+    }
+
+    pub fn setEmptyString(self: Self) void {
+        c.v8__ReturnValue__SetEmptyString(self.inner);
     }
 
     pub fn setValueHandle(self: Self, ptr: *const c.Value) void {
@@ -691,6 +1210,13 @@ pub const FunctionTemplate = struct {
         };
     }
 
+    /// The callback is only invoked when the receiver is compatible with the signature, otherwise V8 throws an "Illegal invocation" TypeError.
+    pub fn initCallbackSignature(isolate: Isolate, callback: c.FunctionCallback, data_val: ?Value, signature: Signature) Self {
+        return .{
+            .handle = c.v8__FunctionTemplate__New__DEFAULT4(isolate.handle, callback, if (data_val) |val| val.handle else null, signature.handle).?,
+        };
+    }
+
     /// This is typically used to set class fields.
     pub fn getInstanceTemplate(self: Self) ObjectTemplate {
         return .{
@@ -731,6 +1257,25 @@ pub const FunctionTemplate = struct {
     }
 };
 
+/// [V8]
+/// A Signature specifies which receiver is valid for a function.
+///
+/// A receiver matches a given signature if the receiver (or any of its
+/// hidden prototypes) was created from the signature's FunctionTemplate, or
+/// from a FunctionTemplate that inherits directly or indirectly from the
+/// signature's FunctionTemplate.
+pub const Signature = struct {
+    const Self = @This();
+
+    handle: *const c.Signature,
+
+    pub fn init(isolate: Isolate, receiver: FunctionTemplate) Self {
+        return .{
+            .handle = c.v8__Signature__New(isolate.handle, receiver.handle).?,
+        };
+    }
+};
+
 pub const Function = struct {
     const Self = @This();
 
@@ -824,7 +1369,7 @@ pub fn Persistent(comptime T: type) type {
         /// When cb_type is kInternalFields, the object fields are expected to be set with setAlignedPointerInInternalField.
         /// The pointer value must be a multiple of 2 due to how v8 encodes the pointers.
         pub fn setWeakFinalizer(self: *Self, finalizer_ctx: *anyopaque, cb: c.WeakCallback, cb_type: WeakCallbackType) void {
-            c.v8__Persistent__SetWeakFinalizer(@ptrCast(&self.inner.handle), finalizer_ctx, cb, @intCast(cb_type));
+            c.v8__Persistent__SetWeakFinalizer(@ptrCast(&self.inner.handle), finalizer_ctx, cb, @intCast(@intFromEnum(cb_type)));
         }
 
         /// Should only be called if you know the underlying type is a v8.Function.
@@ -857,38 +1402,554 @@ pub fn Persistent(comptime T: type) type {
 }
 
 /// [V8]
-/// kParameter will pass a void* parameter back to the callback, kInternalFields
-/// will pass the first two internal fields back to the callback, kFinalizer
-/// will pass a void* parameter back, but is invoked before the object is
-/// actually collected, so it can be resurrected. In the last case, it is not
-/// possible to request a second pass callback.
-pub const WeakCallbackType = enum(u32) {
-    kParameter = c.kParameter,
-    kInternalFields = c.kInternalFields,
-    kFinalizer = c.kFinalizer,
-};
+/// A PersistentBase which has move semantics.
+///
+/// Note: Persistent class hierarchy is subject to future changes.
+/// [Notes]
+/// Same handle layout as Persistent. Like a C++ v8::Global, a handle that is weak (setWeak) must be moved with moveTo
+/// or initMove instead of being copied, since V8 remembers where the handle lives.
+pub fn Global(comptime T: type) type {
+    return struct {
+        const Self = @This();
 
-pub const ObjectTemplate = struct {
-    const Self = @This();
+        inner: T,
 
-    handle: *const c.ObjectTemplate,
+        pub fn init(isolate: Isolate, data: T) Self {
+            var handle: *c.Data = undefined;
+            c.v8__Global__New(isolate.handle, getDataHandle(data), @ptrCast(&handle));
+            return .{
+                .inner = .{
+                    .handle = @ptrCast(handle),
+                },
+            };
+        }
 
-    pub fn initDefault(isolate: Isolate) Self {
-        return .{
-            .handle = c.v8__ObjectTemplate__New__DEFAULT(isolate.handle).?,
-        };
-    }
+        pub fn deinit(self: *Self) void {
+            c.v8__Global__Reset(@ptrCast(&self.inner.handle));
+        }
 
-    pub fn init(isolate: Isolate, constructor: FunctionTemplate) Self {
-        return .{
-            .handle = c.v8__ObjectTemplate__New(isolate.handle, constructor.handle).?,
-        };
-    }
+        /// Moves the handle into dest, leaving self empty. Any handle dest already holds is released, so dest must
+        /// be a live or moved-from Global, use initMove for undefined memory.
+        pub fn moveTo(self: *Self, dest: *Self) void {
+            c.v8__Global__MOVE(@ptrCast(&self.inner.handle), @ptrCast(&dest.inner.handle));
+        }
 
-    pub fn initInstance(self: Self, ctx: Context) Object {
-        return .{
-            .handle = c.v8__ObjectTemplate__NewInstance(self.handle, ctx.handle).?,
-        };
+        /// Move-constructs self in place from src, leaving src empty. Unlike moveTo, self can be undefined memory,
+        /// eg. a new slot for a weak handle.
+        pub fn initMove(self: *Self, src: *Self) void {
+            c.v8__Global__MOVE_CONSTRUCT(@ptrCast(&src.inner.handle), @ptrCast(&self.inner.handle));
+        }
+
+        pub fn setWeak(self: *Self) void {
+            c.v8__Persistent__SetWeak(@ptrCast(&self.inner.handle));
+        }
+
+        /// See Persistent.setWeakFinalizer.
+        pub fn setWeakFinalizer(self: *Self, finalizer_ctx: *anyopaque, cb: c.WeakCallback, cb_type: WeakCallbackType) void {
+            c.v8__Persistent__SetWeakFinalizer(@ptrCast(&self.inner.handle), finalizer_ctx, cb, @intCast(@intFromEnum(cb_type)));
+        }
+
+        pub fn get(self: Self) T {
+            return self.inner;
+        }
+    };
+}
+
+/// Allocates Global handles from fixed size chunks, so creating many handles doesn't allocate per handle
+/// and all of them can be released together, eg. when a context is torn down.
+/// V8 already pools the underlying global handle nodes. The slab removes the per-handle bookkeeping on the Zig side
+/// and resets a whole chunk with one native call.
+/// Returned pointers are stable until reset or deinit. A single handle can still be released early with its deinit.
+pub fn GlobalSlab(comptime T: type) type {
+    return struct {
+        const Self = @This();
+
+        const ChunkSize = 512;
+
+        comptime {
+            // Chunks are reset in place as an array of c.Global.
+            std.debug.assert(@sizeOf(Global(T)) == @sizeOf(c.Global));
+        }
+
+        const Chunk = struct {
+            slots: [ChunkSize]Global(T),
+            len: usize,
+        };
+
+        alloc: std.mem.Allocator,
+        chunks: std.ArrayListUnmanaged(*Chunk),
+        /// Index of the first chunk with free slots.
+        cur: usize,
+
+        pub fn init(alloc: std.mem.Allocator) Self {
+            return .{
+                .alloc = alloc,
+                .chunks = .{},
+                .cur = 0,
+            };
+        }
+
+        pub fn deinit(self: *Self) void {
+            self.reset();
+            for (self.chunks.items) |chunk| {
+                self.alloc.destroy(chunk);
+            }
+            self.chunks.deinit(self.alloc);
+        }
+
+        pub fn create(self: *Self, isolate: Isolate, data: T) !*Global(T) {
+            if (self.cur == self.chunks.items.len) {
+                const chunk = try self.alloc.create(Chunk);
+                errdefer self.alloc.destroy(chunk);
+                chunk.len = 0;
+                try self.chunks.append(self.alloc, chunk);
+            }
+            const chunk = self.chunks.items[self.cur];
+            const slot = &chunk.slots[chunk.len];
+            slot.* = Global(T).init(isolate, data);
+            chunk.len += 1;
+            if (chunk.len == ChunkSize) {
+                self.cur += 1;
+            }
+            return slot;
+        }
+
+        /// Releases every handle. The chunks are kept for reuse.
+        pub fn reset(self: *Self) void {
+            for (self.chunks.items) |chunk| {
+                if (chunk.len > 0) {
+                    c.v8__Global__Reset__BATCH(@ptrCast(&chunk.slots), chunk.len);
+                    chunk.len = 0;
+                }
+            }
+            self.cur = 0;
+        }
+    };
+}
+
+/// [V8]
+/// Eternal handles are set-once handles that live for the lifetime of the
+/// isolate.
+/// [Notes]
+/// Reading an eternal is an index lookup and there is nothing to release.
+pub fn Eternal(comptime T: type) type {
+    return struct {
+        const Self = @This();
+
+        inner: c.Eternal,
+
+        pub fn init(isolate: Isolate, data: T) Self {
+            var self: Self = undefined;
+            c.v8__Eternal__New(isolate.handle, getDataHandle(data), &self.inner);
+            return self;
+        }
+
+        pub fn get(self: *const Self, isolate: Isolate) T {
+            return .{
+                .handle = @ptrCast(c.v8__Eternal__Get(&self.inner, isolate.handle).?),
+            };
+        }
+    };
+}
+
+pub const FunctionCodeHandling = enum(u32) {
+    kClear = c.kFunctionCodeClear,
+    kKeep = c.kFunctionCodeKeep,
+};
+
+/// A V8 startup snapshot. Pass getStartupData to CreateParams.snapshot_blob to create isolates from it.
+pub const SnapshotBlob = struct {
+    const Self = @This();
+
+    inner: c.StartupData,
+    owned: bool,
+
+    /// Wraps snapshot bytes, eg. read from disk. data must outlive every isolate created from the blob.
+    pub fn initFromData(data: []const u8) Self {
+        return .{
+            .inner = .{
+                .data = data.ptr,
+                .raw_size = @intCast(data.len),
+            },
+            .owned = false,
+        };
+    }
+
+    pub fn deinit(self: *Self) void {
+        if (self.owned) {
+            c.v8__StartupData__DeleteData(&self.inner);
+        }
+    }
+
+    pub fn getData(self: Self) []const u8 {
+        return self.inner.data[0..@intCast(self.inner.raw_size)];
+    }
+
+    pub fn getStartupData(self: *Self) *c.StartupData {
+        return &self.inner;
+    }
+};
+
+/// [V8]
+/// Helper class to create a snapshot data blob.
+///
+/// The Isolate used by a SnapshotCreator is owned by it, and will be entered
+/// and exited by the constructor and destructor, respectively; The destructor
+/// will also destroy the Isolate. Experimental language features, including
+/// those available by default, are not available while creating a snapshot.
+/// [Notes]
+/// Set up globals in contexts created on getIsolate, register them with setDefaultContext and addContext,
+/// close every HandleScope, then call createBlob. Native callbacks referenced from the contexts must be listed
+/// in external_references, with the same list passed when isolates are created from the blob.
+pub const SnapshotCreator = struct {
+    const Self = @This();
+
+    handle: *c.SnapshotCreator,
+
+    /// external_references is a null terminated list of native function addresses.
+    pub fn init(external_references: ?[*:0]const isize, existing_blob: ?*const SnapshotBlob) Self {
+        return .{
+            .handle = c.v8__SnapshotCreator__NEW(external_references, if (existing_blob) |blob| &blob.inner else null).?,
+        };
+    }
+
+    /// Also disposes the isolate. createBlob must have been called first, V8 checks this in debug builds.
+    pub fn deinit(self: Self) void {
+        c.v8__SnapshotCreator__DELETE(self.handle);
+    }
+
+    /// [V8]
+    /// \returns the isolate prepared by the snapshot creator.
+    pub fn getIsolate(self: Self) Isolate {
+        return .{
+            .handle = c.v8__SnapshotCreator__GetIsolate(self.handle).?,
+        };
+    }
+
+    /// [V8]
+    /// Set the default context to be included in the snapshot blob.
+    /// The snapshot will not contain the global proxy, and we expect one or a
+    /// global object template to create one, to be provided upon deserialization.
+    pub fn setDefaultContext(self: Self, ctx: Context) void {
+        c.v8__SnapshotCreator__SetDefaultContext(self.handle, ctx.handle);
+    }
+
+    /// [V8]
+    /// Add additional context to be included in the snapshot blob.
+    /// The snapshot will include the global proxy.
+    ///
+    /// \returns the index of the context in the snapshot blob.
+    pub fn addContext(self: Self, ctx: Context) usize {
+        return c.v8__SnapshotCreator__AddContext(self.handle, ctx.handle);
+    }
+
+    /// [V8]
+    /// Created a snapshot data blob.
+    /// This must not be called from within a handle scope.
+    /// \param function_code_handling whether to include compiled function code
+    ///        in the snapshot.
+    /// \returns { nullptr, 0 } on failure, and a startup snapshot on success. The
+    ///        caller acquires ownership of the data array in the return value.
+    pub fn createBlob(self: Self, function_code_handling: FunctionCodeHandling) !SnapshotBlob {
+        const data = c.v8__SnapshotCreator__CreateBlob(self.handle, @intCast(@intFromEnum(function_code_handling)));
+        if (data.data == null) {
+            return error.SnapshotFailed;
+        }
+        return .{
+            .inner = data,
+            .owned = true,
+        };
+    }
+};
+
+/// Creates clean contexts deserialized from a context snapshot, so a request can start from a known global
+/// state without running setup scripts, and tells V8 when a context is thrown away so the GC can reclaim it promptly.
+/// It doesn't keep track of the contexts it creates.
+pub const SnapshotContextFactory = struct {
+    const Self = @This();
+
+    isolate: Isolate,
+    /// Index returned by SnapshotCreator.addContext.
+    context_snapshot_index: usize,
+    queue: ?MicrotaskQueue,
+
+    pub fn init(isolate: Isolate, context_snapshot_index: usize, queue: ?MicrotaskQueue) Self {
+        return .{
+            .isolate = isolate,
+            .context_snapshot_index = context_snapshot_index,
+            .queue = queue,
+        };
+    }
+
+    /// Deserializes a fresh context. The handle belongs to the current HandleScope.
+    pub fn create(self: Self) !Context {
+        return Context.initFromSnapshot(self.isolate, self.context_snapshot_index, self.queue);
+    }
+
+    /// Call once a created context has been exited and nothing references it anymore, including Persistent and Global handles.
+    pub fn notifyDisposed(self: Self) void {
+        // Contexts from the snapshot don't share state with each other.
+        _ = self.isolate.contextDisposedNotification(false);
+    }
+};
+
+/// [V8]
+/// A traced handle without destructor that clears the handle. The embedder needs
+/// to ensure that the handle is not accessed once the V8 object has been
+/// reclaimed.
+/// [Notes]
+/// A TracedReference keeps its target alive only while it's traced, so it should be a field of a GcObject payload
+/// and be visited from its trace function. It must not be copied after init.
+pub fn TracedReference(comptime T: type) type {
+    return struct {
+        const Self = @This();
+
+        inner: c.TracedReference,
+
+        /// An empty reference, for initializing GcObject payloads.
+        pub const empty = Self{ .inner = std.mem.zeroes(c.TracedReference) };
+
+        /// Constructs an empty reference in place.
+        pub fn init(self: *Self) void {
+            c.v8__TracedReference__CONSTRUCT(&self.inner);
+        }
+
+        pub fn deinit(self: *Self) void {
+            c.v8__TracedReference__DESTRUCT(&self.inner);
+        }
+
+        pub fn set(self: *Self, isolate: Isolate, value: T) void {
+            c.v8__TracedReference__Reset(&self.inner, isolate.handle, getValueHandle(value));
+        }
+
+        pub fn reset(self: *Self) void {
+            c.v8__TracedReference__Reset__EMPTY(&self.inner);
+        }
+
+        pub fn isEmpty(self: *const Self) bool {
+            return c.v8__TracedReference__IsEmpty(&self.inner);
+        }
+
+        /// Returns null if the reference is empty.
+        pub fn get(self: *const Self, isolate: Isolate) ?T {
+            if (c.v8__TracedReference__Get(&self.inner, isolate.handle)) |handle| {
+                return T{
+                    .handle = @ptrCast(handle),
+                };
+            } else return null;
+        }
+    };
+}
+
+/// [V8]
+/// A heap for allocating managed C++ objects.
+///
+/// Similar to v8::Isolate, the heap may only be accessed from one thread at a
+/// time.
+/// [Notes]
+/// Once attached to an isolate, GcObjects and JS objects are marked together, so edges in both directions
+/// (TracedReference from native to JS, wrapper internal fields from JS to native) are collected in a single cycle,
+/// including cycles that span both heaps.
+/// Setup order: initCppgcProcess once, then init and Isolate.attachCppHeap. Teardown: Isolate.detachCppHeap, terminate, deinit.
+pub const CppHeap = struct {
+    const Self = @This();
+
+    /// Internal field indices used on JS wrapper objects. Wrapper templates need an internal field count of at least 2.
+    pub const WrapperTypeIndex = 0;
+    pub const WrapperInstanceIndex = 1;
+    /// Identifies wrappers owned by GcObject. V8 compares it with the first u16 pointed to by the type field.
+    pub const EmbedderId: u16 = 0x7a69;
+    const wrapper_type_info: u16 align(8) = EmbedderId;
+
+    handle: *c.CppHeap,
+
+    pub fn init(platform: Platform) Self {
+        return .{
+            .handle = c.v8__CppHeap__Create(platform.handle, WrapperTypeIndex, WrapperInstanceIndex, EmbedderId).?,
+        };
+    }
+
+    /// [V8]
+    /// Terminate clears all roots and performs multiple garbage collections to
+    /// reclaim potentially newly created objects in destructors.
+    ///
+    /// After this call, object allocation is prohibited.
+    pub fn terminate(self: Self) void {
+        c.v8__CppHeap__Terminate(self.handle);
+    }
+
+    /// The heap must be detached first.
+    pub fn deinit(self: Self) void {
+        c.v8__CppHeap__DELETE(self.handle);
+    }
+};
+
+/// Must be called once per process before a CppHeap is created, after the platform is initialized.
+pub fn initCppgcProcess(platform: Platform) void {
+    c.v8__cppgc__InitializeProcess(platform.handle);
+}
+
+pub fn deinitCppgcProcess() void {
+    c.v8__cppgc__ShutdownProcess();
+}
+
+/// Passed to GcObject trace functions. Tracing can run concurrently with the mutator, so trace should only read fields.
+pub const CppgcVisitor = struct {
+    const Self = @This();
+
+    handle: *c.CppgcVisitor,
+
+    pub fn traceReference(self: Self, comptime T: type, ref: *const TracedReference(T)) void {
+        c.v8__CppgcVisitor__TraceReference(self.handle, &ref.inner);
+    }
+
+    pub fn traceMember(self: Self, member: *const GcMember) void {
+        c.v8__CppgcVisitor__TraceMember(self.handle, &member.inner);
+    }
+};
+
+/// A traced edge from a GcObject payload to another GcObject. Assignments go through cppgc's write barrier.
+pub const GcMember = struct {
+    const Self = @This();
+
+    inner: c.GcMember,
+
+    /// An empty member, for initializing GcObject payloads.
+    pub const empty = Self{ .inner = std.mem.zeroes(c.GcMember) };
+
+    /// Constructs an empty member in place.
+    pub fn init(self: *Self) void {
+        c.v8__GcMember__CONSTRUCT(&self.inner);
+    }
+
+    pub fn set(self: *Self, obj: anytype) void {
+        c.v8__GcMember__Set(&self.inner, obj.handle);
+    }
+
+    pub fn clear(self: *Self) void {
+        c.v8__GcMember__Set(&self.inner, null);
+    }
+
+    /// Returns null if the member is empty.
+    pub fn get(self: *const Self, comptime T: type) ?GcObject(T) {
+        if (c.v8__GcMember__Get(&self.inner)) |handle| {
+            return GcObject(T){
+                .handle = @constCast(handle),
+            };
+        } else return null;
+    }
+};
+
+/// A Zig value of type T that lives on the CppHeap and takes part in V8's unified heap marking.
+/// T must declare `pub fn trace(self: *const T, visitor: CppgcVisitor) void` which visits every TracedReference and GcMember field,
+/// and can declare `pub fn finalize(self: *T) void` which runs when the object is reclaimed.
+/// Objects are kept alive by the stack, by GcMember fields of other live objects, or by a JS wrapper (see wrap).
+pub fn GcObject(comptime T: type) type {
+    comptime {
+        if (@alignOf(T) > 8) {
+            @compileError(std.fmt.comptimePrint("{s} must not be aligned to more than 8 bytes", .{@typeName(T)}));
+        }
+        if (!@hasDecl(T, "trace")) {
+            @compileError(std.fmt.comptimePrint("{s} must declare trace", .{@typeName(T)}));
+        }
+    }
+
+    return struct {
+        const Self = @This();
+
+        const vtable = c.GcObjectVtable{
+            .trace = trace,
+            .finalize = finalize,
+        };
+
+        handle: *c.GcObject,
+
+        /// The payload is allocated inline with the cppgc object and value is copied into it before the object is
+        /// visible to the marker. TracedReference and GcMember fields in value must be `.empty`; point them at their
+        /// targets with set afterwards, which goes through the write barrier.
+        pub fn create(heap: CppHeap, value: T) Self {
+            return .{
+                .handle = c.v8__cppgc__MakeGarbageCollected(heap.handle, @sizeOf(T), &vtable, initPayload, &value).?,
+            };
+        }
+
+        pub fn get(self: Self) *T {
+            return @ptrCast(@alignCast(c.v8__GcObject__Data(self.handle)));
+        }
+
+        pub fn fromPtr(ptr: *const T) Self {
+            return .{
+                .handle = c.v8__GcObject__FromData(ptr).?,
+            };
+        }
+
+        /// Links a JS wrapper to this object so it stays alive as long as the wrapper is reachable.
+        /// obj must have been created from a template with at least 2 internal fields.
+        pub fn wrap(self: Self, obj: Object) void {
+            obj.setAlignedPointerInInternalField(CppHeap.WrapperTypeIndex, @constCast(&CppHeap.wrapper_type_info));
+            obj.setAlignedPointerInInternalField(CppHeap.WrapperInstanceIndex, self.handle);
+        }
+
+        /// Returns the object linked to a wrapper with wrap.
+        pub fn unwrap(obj: Object) Self {
+            return .{
+                .handle = @ptrCast(obj.getAlignedPointerFromInternalField(CppHeap.WrapperInstanceIndex).?),
+            };
+        }
+
+        fn initPayload(data: ?*anyopaque, init_data: ?*const anyopaque) callconv(.C) void {
+            const ptr: *T = @ptrCast(@alignCast(data.?));
+            const value: *const T = @ptrCast(@alignCast(init_data.?));
+            ptr.* = value.*;
+        }
+
+        fn trace(data: ?*const anyopaque, visitor: ?*c.CppgcVisitor) callconv(.C) void {
+            const ptr: *const T = @ptrCast(@alignCast(data.?));
+            ptr.trace(.{ .handle = visitor.? });
+        }
+
+        fn finalize(data: ?*anyopaque) callconv(.C) void {
+            if (@hasDecl(T, "finalize")) {
+                const ptr: *T = @ptrCast(@alignCast(data.?));
+                ptr.finalize();
+            }
+        }
+    };
+}
+
+/// [V8]
+/// kParameter will pass a void* parameter back to the callback, kInternalFields
+/// will pass the first two internal fields back to the callback, kFinalizer
+/// will pass a void* parameter back, but is invoked before the object is
+/// actually collected, so it can be resurrected. In the last case, it is not
+/// possible to request a second pass callback.
+pub const WeakCallbackType = enum(u32) {
+    kParameter = c.kParameter,
+    kInternalFields = c.kInternalFields,
+    kFinalizer = c.kFinalizer,
+};
+
+pub const ObjectTemplate = struct {
+    const Self = @This();
+
+    handle: *const c.ObjectTemplate,
+
+    pub fn initDefault(isolate: Isolate) Self {
+        return .{
+            .handle = c.v8__ObjectTemplate__New__DEFAULT(isolate.handle).?,
+        };
+    }
+
+    pub fn init(isolate: Isolate, constructor: FunctionTemplate) Self {
+        return .{
+            .handle = c.v8__ObjectTemplate__New(isolate.handle, constructor.handle).?,
+        };
+    }
+
+    pub fn initInstance(self: Self, ctx: Context) Object {
+        return .{
+            .handle = c.v8__ObjectTemplate__NewInstance(self.handle, ctx.handle).?,
+        };
     }
 
     pub fn setGetter(self: Self, name: anytype, getter: c.AccessorNameGetterCallback) void {
@@ -907,6 +1968,52 @@ pub const ObjectTemplate = struct {
         c.v8__ObjectTemplate__SetInternalFieldCount(self.handle, @intCast(count));
     }
 
+    /// [V8]
+    /// Sets a named property handler on the object template.
+    ///
+    /// Whenever a property whose name is a string or a symbol is accessed on
+    /// objects created from this object template, the provided callback is
+    /// invoked instead of accessing the property directly on the JavaScript
+    /// object.
+    /// [Notes]
+    /// Interceptors are resolved on demand, so large native tables can be exposed without creating a JS property per entry.
+    /// A callback intercepts the request by setting a return value; if it doesn't, the lookup falls through to the object.
+    pub fn setNamedHandler(self: Self, config: NamedPropertyHandlerConfiguration) void {
+        const c_config = c.NamedPropertyHandlerConfiguration{
+            .getter = config.getter,
+            .setter = config.setter,
+            .query = config.query,
+            .deleter = config.deleter,
+            .enumerator = config.enumerator,
+            .definer = config.definer,
+            .descriptor = config.descriptor,
+            .data = if (config.data) |data| data.handle else null,
+            .flags = config.flags,
+        };
+        c.v8__ObjectTemplate__SetNamedHandler(self.handle, &c_config);
+    }
+
+    /// [V8]
+    /// Sets an indexed property handler on the object template.
+    ///
+    /// Whenever an indexed property is accessed on objects created from
+    /// this object template, the provided callback is invoked instead of
+    /// accessing the property directly on the JavaScript object.
+    pub fn setIndexedHandler(self: Self, config: IndexedPropertyHandlerConfiguration) void {
+        const c_config = c.IndexedPropertyHandlerConfiguration{
+            .getter = config.getter,
+            .setter = config.setter,
+            .query = config.query,
+            .deleter = config.deleter,
+            .enumerator = config.enumerator,
+            .definer = config.definer,
+            .descriptor = config.descriptor,
+            .data = if (config.data) |data| data.handle else null,
+            .flags = config.flags,
+        };
+        c.v8__ObjectTemplate__SetIndexedHandler(self.handle, &c_config);
+    }
+
     pub fn toValue(self: Self) Value {
         return .{
             .handle = self.handle,
@@ -914,6 +2021,334 @@ pub const ObjectTemplate = struct {
     }
 };
 
+/// Generates the JS class glue for a native Zig struct type T and caches the resulting FunctionTemplate.
+/// [Notes]
+/// - Fields of type bool, int or float are exposed as accessors on the instance template.
+/// - Pub functions whose first param is T, *T or *const T are exposed as prototype methods if the remaining
+///   params are bool, int, float, Value or Object and the return type is void, bool, int, float, []const u8, Value, Object
+///   or an error union of those. An error is thrown in JS as an Error with the error name. Other decls are skipped.
+/// - Methods are created with a Signature so V8 rejects incompatible receivers before the callback runs.
+/// - Instances are created from Zig with newInstance, calling the constructor from JS throws a TypeError.
+/// - Each instance is weakly held. When the JS object is collected, T.deinit(*T) is called if declared and the wrapper is freed.
+pub fn Class(comptime T: type) type {
+    return struct {
+        const Self = @This();
+
+        /// Heap allocated wrapper that is referenced by the first internal field of the JS object.
+        const Instance = struct {
+            value: T,
+            handle: Persistent(Object),
+            alloc: std.mem.Allocator,
+        };
+
+        const class_name = blk: {
+            const name = @typeName(T);
+            break :blk if (std.mem.lastIndexOfScalar(u8, name, '.')) |idx| name[idx + 1 ..] else name;
+        };
+
+        template: Persistent(FunctionTemplate),
+        alloc: std.mem.Allocator,
+
+        pub fn init(iso: Isolate, alloc: std.mem.Allocator) Self {
+            const tmpl = FunctionTemplate.initCallback(iso, &construct);
+            tmpl.setClassName(String.initUtf8(iso, class_name));
+
+            const inst_tmpl = tmpl.getInstanceTemplate();
+            inst_tmpl.setInternalFieldCount(1);
+            inline for (@typeInfo(T).Struct.fields) |field| {
+                if (comptime isSupportedArg(field.type) and field.type != Value and field.type != Object) {
+                    const accessor = FieldAccessor(field.name);
+                    inst_tmpl.setGetterAndSetter(String.initUtf8(iso, field.name), &accessor.get, &accessor.set);
+                }
+            }
+
+            const proto = tmpl.getPrototypeTemplate();
+            const signature = Signature.init(iso, tmpl);
+            inline for (@typeInfo(T).Struct.decls) |decl| {
+                if (comptime isMethod(decl.name)) {
+                    const method = FunctionTemplate.initCallbackSignature(iso, &Method(decl.name).call, null, signature);
+                    proto.set(String.initUtf8(iso, decl.name), method, PropertyAttribute.None);
+                }
+            }
+
+            return .{
+                .template = Persistent(FunctionTemplate).init(iso, tmpl),
+                .alloc = alloc,
+            };
+        }
+
+        /// Releases the cached template. Live instances are still finalized by the GC.
+        pub fn deinit(self: *Self) void {
+            self.template.deinit();
+        }
+
+        pub fn getFunctionTemplate(self: Self) FunctionTemplate {
+            return self.template.inner;
+        }
+
+        /// Returns the class constructor for the context so it can be exposed on a global.
+        pub fn getConstructor(self: Self, ctx: Context) Function {
+            return self.template.inner.getFunction(ctx);
+        }
+
+        /// Moves value into a heap allocated wrapper owned by the returned JS object.
+        pub fn newInstance(self: Self, ctx: Context, value: T) !Object {
+            const inst = try self.alloc.create(Instance);
+            const obj = self.template.inner.getInstanceTemplate().initInstance(ctx);
+            obj.setAlignedPointerInInternalField(0, inst);
+            inst.* = .{
+                .value = value,
+                .handle = Persistent(Object).init(ctx.getIsolate(), obj),
+                .alloc = self.alloc,
+            };
+            inst.handle.setWeakFinalizer(inst, &finalize, .kParameter);
+            return obj;
+        }
+
+        /// Returns the native value of an object that was created with newInstance.
+        pub fn unwrap(obj: Object) *T {
+            const inst: *Instance = @ptrCast(@alignCast(obj.getAlignedPointerFromInternalField(0).?));
+            return &inst.value;
+        }
+
+        fn construct(raw_info: ?*const c.FunctionCallbackInfo) callconv(.C) void {
+            const iso = FunctionCallbackInfo.initFromV8(raw_info).getIsolate();
+            _ = iso.throwException(Exception.initTypeError(String.initUtf8(iso, "Illegal constructor")));
+        }
+
+        fn finalize(raw_info: ?*const c.WeakCallbackInfo) callconv(.C) void {
+            const info = WeakCallbackInfo.initFromC(raw_info);
+            const inst: *Instance = @ptrCast(@alignCast(info.getParameter()));
+            inst.handle.deinit();
+            if (@hasDecl(T, "deinit")) {
+                inst.value.deinit();
+            }
+            inst.alloc.destroy(inst);
+        }
+
+        fn FieldAccessor(comptime name: []const u8) type {
+            return struct {
+                fn get(_: ?*const c.Name, raw_info: ?*const c.PropertyCallbackInfo) callconv(.C) void {
+                    const info = PropertyCallbackInfo.initFromV8(raw_info);
+                    const ptr = unwrap(info.getHolder());
+                    setResult(info.getIsolate(), info.getReturnValue(), @field(ptr, name));
+                }
+
+                fn set(_: ?*const c.Name, raw_value: ?*const c.Value, raw_info: ?*const c.PropertyCallbackInfo) callconv(.C) void {
+                    const info = PropertyCallbackInfo.initFromV8(raw_info);
+                    const iso = info.getIsolate();
+                    const ptr = unwrap(info.getHolder());
+                    const value = Value{ .handle = raw_value.? };
+                    @field(ptr, name) = fromValue(@TypeOf(@field(ptr, name)), iso, iso.getCurrentContext(), value) catch return;
+                }
+            };
+        }
+
+        fn Method(comptime name: []const u8) type {
+            return struct {
+                fn call(raw_info: ?*const c.FunctionCallbackInfo) callconv(.C) void {
+                    const info = FunctionCallbackInfo.initFromV8(raw_info);
+                    const iso = info.getIsolate();
+                    const func = @field(T, name);
+                    const params = @typeInfo(@TypeOf(func)).Fn.params;
+
+                    const ptr = unwrap(info.getThis());
+                    var args: std.meta.ArgsTuple(@TypeOf(func)) = undefined;
+                    args[0] = if (params[0].type.? == T) ptr.* else ptr;
+                    if (params.len > 1) {
+                        const ctx = iso.getCurrentContext();
+                        inline for (params[1..], 1..) |param, i| {
+                            args[i] = fromValue(param.type.?, iso, ctx, info.getArg(i - 1)) catch return;
+                        }
+                    }
+                    setResult(iso, info.getReturnValue(), @call(.auto, func, args));
+                }
+            };
+        }
+
+        fn isMethod(comptime name: []const u8) bool {
+            if (std.mem.eql(u8, name, "deinit")) {
+                return false;
+            }
+            const info = switch (@typeInfo(@TypeOf(@field(T, name)))) {
+                .Fn => |info| info,
+                else => return false,
+            };
+            if (info.is_generic or info.is_var_args or info.params.len == 0) {
+                return false;
+            }
+            const SelfParam = info.params[0].type orelse return false;
+            if (SelfParam != T and SelfParam != *T and SelfParam != *const T) {
+                return false;
+            }
+            for (info.params[1..]) |param| {
+                if (!isSupportedArg(param.type orelse return false)) {
+                    return false;
+                }
+            }
+            return isSupportedResult(info.return_type orelse return false);
+        }
+
+        fn isSupportedArg(comptime V: type) bool {
+            return switch (@typeInfo(V)) {
+                .Bool, .Int, .Float => true,
+                else => V == Value or V == Object,
+            };
+        }
+
+        fn isSupportedResult(comptime V: type) bool {
+            return switch (@typeInfo(V)) {
+                .Void, .Bool, .Int, .Float => true,
+                .ErrorUnion => |info| isSupportedResult(info.payload),
+                else => V == []const u8 or V == Value or V == Object,
+            };
+        }
+
+        /// Returns error.JsException if the conversion threw or the value has the wrong type.
+        fn fromValue(comptime V: type, iso: Isolate, ctx: Context, value: Value) !V {
+            switch (@typeInfo(V)) {
+                .Bool => return value.toBool(iso),
+                .Int => |info| {
+                    if (info.bits <= 32) {
+                        if (info.signedness == .signed) {
+                            return @truncate(try value.toI32(ctx));
+                        } else {
+                            return @truncate(try value.toU32(ctx));
+                        }
+                    } else {
+                        return std.math.lossyCast(V, try value.toF64(ctx));
+                    }
+                },
+                .Float => return @floatCast(try value.toF64(ctx)),
+                else => {
+                    if (V == Object) {
+                        if (!value.isObject()) {
+                            _ = iso.throwException(Exception.initTypeError(String.initUtf8(iso, "Expected an object")));
+                            return error.JsException;
+                        }
+                        return value.castTo(Object);
+                    }
+                    return value;
+                },
+            }
+        }
+
+        fn setResult(iso: Isolate, rv: ReturnValue, res: anytype) void {
+            const V = @TypeOf(res);
+            switch (@typeInfo(V)) {
+                .Void => {},
+                .ErrorUnion => {
+                    const payload = res catch |err| {
+                        _ = iso.throwException(Exception.initError(String.initUtf8(iso, @errorName(err))));
+                        return;
+                    };
+                    setResult(iso, rv, payload);
+                },
+                else => {
+                    if (V == []const u8) {
+                        if (res.len == 0) {
+                            rv.setEmptyString();
+                        } else {
+                            rv.set(String.initUtf8(iso, res));
+                        }
+                    } else {
+                        rv.set(res);
+                    }
+                },
+            }
+        }
+    };
+}
+
+/// Callbacks for ObjectTemplate.setNamedHandler. Unset callbacks are not intercepted.
+/// The query callback returns the PropertyAttribute as an Integer, the deleter returns a Boolean
+/// and the enumerator returns an Array of the intercepted property names.
+pub const NamedPropertyHandlerConfiguration = struct {
+    getter: c.NamedPropertyGetterCallback = null,
+    setter: c.NamedPropertySetterCallback = null,
+    query: c.NamedPropertyQueryCallback = null,
+    deleter: c.NamedPropertyDeleterCallback = null,
+    enumerator: c.NamedPropertyEnumeratorCallback = null,
+    definer: c.NamedPropertyDefinerCallback = null,
+    descriptor: c.NamedPropertyDescriptorCallback = null,
+    data: ?Value = null,
+    flags: c.PropertyHandlerFlags = PropertyHandlerFlags.kNone,
+};
+
+/// Callbacks for ObjectTemplate.setIndexedHandler. Same as NamedPropertyHandlerConfiguration but keyed by index.
+pub const IndexedPropertyHandlerConfiguration = struct {
+    getter: c.IndexedPropertyGetterCallback = null,
+    setter: c.IndexedPropertySetterCallback = null,
+    query: c.IndexedPropertyQueryCallback = null,
+    deleter: c.IndexedPropertyDeleterCallback = null,
+    enumerator: c.IndexedPropertyEnumeratorCallback = null,
+    definer: c.IndexedPropertyDefinerCallback = null,
+    descriptor: c.IndexedPropertyDescriptorCallback = null,
+    data: ?Value = null,
+    flags: c.PropertyHandlerFlags = PropertyHandlerFlags.kNone,
+};
+
+/// Passed to a definer interceptor. Fields that were not present in the definition are null.
+pub const PropertyDescriptor = struct {
+    const Self = @This();
+
+    handle: *const c.PropertyDescriptor,
+
+    pub fn initFromC(val: ?*const c.PropertyDescriptor) Self {
+        return .{
+            .handle = val.?,
+        };
+    }
+
+    pub fn getValue(self: Self) ?Value {
+        if (!c.v8__PropertyDescriptor__has_value(self.handle)) {
+            return null;
+        }
+        return Value{
+            .handle = c.v8__PropertyDescriptor__value(self.handle).?,
+        };
+    }
+
+    pub fn getGetter(self: Self) ?Value {
+        if (!c.v8__PropertyDescriptor__has_get(self.handle)) {
+            return null;
+        }
+        return Value{
+            .handle = c.v8__PropertyDescriptor__get(self.handle).?,
+        };
+    }
+
+    pub fn getSetter(self: Self) ?Value {
+        if (!c.v8__PropertyDescriptor__has_set(self.handle)) {
+            return null;
+        }
+        return Value{
+            .handle = c.v8__PropertyDescriptor__set(self.handle).?,
+        };
+    }
+
+    pub fn getEnumerable(self: Self) ?bool {
+        if (!c.v8__PropertyDescriptor__has_enumerable(self.handle)) {
+            return null;
+        }
+        return c.v8__PropertyDescriptor__enumerable(self.handle);
+    }
+
+    pub fn getConfigurable(self: Self) ?bool {
+        if (!c.v8__PropertyDescriptor__has_configurable(self.handle)) {
+            return null;
+        }
+        return c.v8__PropertyDescriptor__configurable(self.handle);
+    }
+
+    pub fn getWritable(self: Self) ?bool {
+        if (!c.v8__PropertyDescriptor__has_writable(self.handle)) {
+            return null;
+        }
+        return c.v8__PropertyDescriptor__writable(self.handle);
+    }
+};
+
 pub const Array = struct {
     const Self = @This();
 
@@ -932,10 +2367,51 @@ pub const Array = struct {
         };
     }
 
+    /// Creates the array in one call. Element handles are created in a nested scope so only the array handle is left in the current scope.
+    pub fn initF64(iso: Isolate, elems: []const f64) Self {
+        return .{
+            .handle = c.v8__Array__New__F64(iso.handle, elems.ptr, elems.len).?,
+        };
+    }
+
+    /// Same as initF64. Values that fit in a Smi don't allocate on the V8 heap.
+    pub fn initI32(iso: Isolate, elems: []const i32) Self {
+        return .{
+            .handle = c.v8__Array__New__I32(iso.handle, elems.ptr, elems.len).?,
+        };
+    }
+
+    pub fn initU32(iso: Isolate, elems: []const u32) Self {
+        return .{
+            .handle = c.v8__Array__New__U32(iso.handle, elems.ptr, elems.len).?,
+        };
+    }
+
     pub fn length(self: Self) u32 {
         return c.v8__Array__Length(self.handle);
     }
 
+    /// Copies up to out.len element handles into out with one native call and returns the number copied.
+    /// The handles belong to the current HandleScope.
+    pub fn copyToValues(self: Self, ctx: Context, out: []Value) !usize {
+        var copied: usize = undefined;
+        const c_out: ?[*]?*const c.Value = @ptrCast(out.ptr);
+        if (!c.v8__Array__CopyTo__VALUES(self.handle, ctx.handle, c_out, out.len, &copied)) {
+            return error.JsException;
+        }
+        return copied;
+    }
+
+    /// Copies up to out.len numbers into out with one native call and returns the number copied.
+    /// Copying stops early at the first element that isn't a number.
+    pub fn copyToF64(self: Self, ctx: Context, out: []f64) !usize {
+        var copied: usize = undefined;
+        if (!c.v8__Array__CopyTo__F64(self.handle, ctx.handle, out.ptr, out.len, &copied)) {
+            return error.JsException;
+        }
+        return copied;
+    }
+
     pub fn castTo(self: Self, comptime T: type) T {
         switch (T) {
             Object => {
@@ -959,6 +2435,26 @@ pub const Object = struct {
         };
     }
 
+    /// [V8]
+    /// Creates a JavaScript object with the given properties, and
+    /// a the given prototype_or_null (which can be any JavaScript
+    /// value, and if it's null, the newly created object won't have
+    /// a prototype at all). This is similar to Object.create().
+    /// All properties will be created as enumerable, configurable
+    /// and writable properties.
+    /// [Notes]
+    /// The object is created with its final shape in one call. Names must be unique.
+    /// A null prototype puts the object in dictionary mode. For a regular fast object pass Object.prototype, eg.
+    /// fetched once with Object.init(iso).getPrototype() and kept in a Global.
+    pub fn initWithProperties(isolate: Isolate, prototype_or_null: anytype, names: []const String, values: []const Value) Self {
+        std.debug.assert(names.len == values.len);
+        const c_names: ?[*]const ?*c.Name = @ptrCast(names.ptr);
+        const c_values: ?[*]const ?*c.Value = @ptrCast(values.ptr);
+        return .{
+            .handle = c.v8__Object__New2(isolate.handle, getValueHandle(prototype_or_null), c_names, c_values, names.len).?,
+        };
+    }
+
     pub fn setInternalField(self: Self, idx: u32, value: anytype) void {
         c.v8__Object__SetInternalField(self.handle, @intCast(idx), getValueHandle(value));
     }
@@ -973,6 +2469,10 @@ pub const Object = struct {
         c.v8__Object__SetAlignedPointerInInternalField(self.handle, @intCast(idx), ptr);
     }
 
+    pub fn getAlignedPointerFromInternalField(self: Self, idx: u32) ?*anyopaque {
+        return c.v8__Object__GetAlignedPointerFromInternalField(self.handle, @intCast(idx));
+    }
+
     // Returns true on success, false on fail.
     pub fn setValue(self: Self, ctx: Context, key: anytype, value: anytype) bool {
         var out: c.MaybeBool = undefined;
@@ -989,6 +2489,26 @@ pub const Object = struct {
         } else return error.JsException;
     }
 
+    /// Gets the values for keys in one native call. out must be at least as long as keys.
+    pub fn getValues(self: Self, ctx: Context, keys: []const Value, out: []Value) !void {
+        std.debug.assert(out.len >= keys.len);
+        const c_keys: ?[*]const ?*c.Value = @ptrCast(keys.ptr);
+        const c_out: ?[*]?*const c.Value = @ptrCast(out.ptr);
+        if (!c.v8__Object__Get__BATCH(self.handle, ctx.handle, c_keys, c_out, keys.len)) {
+            return error.JsException;
+        }
+    }
+
+    /// Sets keys[i] to values[i] in one native call.
+    pub fn setValues(self: Self, ctx: Context, keys: []const Value, values: []const Value) !void {
+        std.debug.assert(keys.len == values.len);
+        const c_keys: ?[*]const ?*c.Value = @ptrCast(keys.ptr);
+        const c_values: ?[*]const ?*c.Value = @ptrCast(values.ptr);
+        if (!c.v8__Object__Set__BATCH(self.handle, ctx.handle, c_keys, c_values, keys.len)) {
+            return error.JsException;
+        }
+    }
+
     pub fn getAtIndex(self: Self, ctx: Context, idx: u32) !Value {
         if (c.v8__Object__GetIndex(self.handle, ctx.handle, idx)) |handle| {
             return Value{
@@ -1027,6 +2547,16 @@ pub const Object = struct {
         return @bitCast(c.v8__Object__GetIdentityHash(self.handle));
     }
 
+    /// [V8]
+    /// Get the prototype object.  This does not skip objects marked to
+    /// be skipped by __proto__ and it does not consult the security
+    /// handler.
+    pub fn getPrototype(self: Self) Value {
+        return .{
+            .handle = c.v8__Object__GetPrototype(self.handle).?,
+        };
+    }
+
     pub fn has(self: Self, ctx: Context, key: Value) bool {
         var out: c.MaybeBool = undefined;
         c.v8__Object__Has(self.handle, ctx.handle, key.handle, &out);
@@ -1172,11 +2702,25 @@ inline fn getValueHandle(val: anytype) *const c.Value {
         Integer => val.handle,
         Primitive => val.handle,
         Number => val.handle,
+        Boolean => val.handle,
         Function => val.handle,
         PromiseResolver => val.handle,
         External => val.handle,
         Array => val.handle,
+        Int8Array => val.handle,
         Uint8Array => val.handle,
+        Uint8ClampedArray => val.handle,
+        Int16Array => val.handle,
+        Uint16Array => val.handle,
+        Int32Array => val.handle,
+        Uint32Array => val.handle,
+        Float32Array => val.handle,
+        Float64Array => val.handle,
+        BigInt64Array => val.handle,
+        BigUint64Array => val.handle,
+        DataView => val.handle,
+        SharedArrayBuffer => val.handle,
+        WasmModuleObject => val.handle,
         StackTrace => val.handle,
         ObjectTemplate => val.handle,
         Persistent(Object) => val.inner.handle,
@@ -1212,6 +2756,7 @@ inline fn getDataHandle(val: anytype) *const c.Data {
         FunctionTemplate => val.handle,
         ObjectTemplate => val.handle,
         Integer => val.handle,
+        String => val.handle,
         Function => val.handle,
         Context => val.handle,
         Object => val.handle,
@@ -1467,6 +3012,49 @@ pub const ScriptOrigin = struct {
     }
 };
 
+/// Holds a persistent internalized string for each comptime key, so a hot property name is an array load instead of a string allocation.
+/// A cache belongs to the isolate it was initialized with.
+///
+/// const Keys = v8.StringCache(&.{ "id", "name" });
+/// var keys = Keys.init(iso);
+/// defer keys.deinit();
+/// _ = try obj.getValue(ctx, keys.get("name"));
+pub fn StringCache(comptime keys: []const []const u8) type {
+    return struct {
+        const Self = @This();
+
+        strings: [keys.len]Persistent(String),
+
+        pub fn init(iso: Isolate) Self {
+            var self: Self = undefined;
+            for (keys, 0..) |key, i| {
+                self.strings[i] = Persistent(String).init(iso, String.initUtf8Internalized(iso, key));
+            }
+            return self;
+        }
+
+        pub fn deinit(self: *Self) void {
+            for (&self.strings) |*str| {
+                str.deinit();
+            }
+        }
+
+        pub fn get(self: *const Self, comptime key: []const u8) String {
+            const idx = comptime indexOfKey(key) orelse @compileError(std.fmt.comptimePrint("\"{s}\" is not a key of this StringCache", .{key}));
+            return self.strings[idx].inner;
+        }
+
+        fn indexOfKey(comptime key: []const u8) ?usize {
+            for (keys, 0..) |k, i| {
+                if (std.mem.eql(u8, k, key)) {
+                    return i;
+                }
+            }
+            return null;
+        }
+    };
+}
+
 pub const Boolean = struct {
     const Self = @This();
 
@@ -1490,6 +3078,18 @@ pub const String = struct {
         };
     }
 
+    /// [V8]
+    /// Acts as a hint that the string should be created in the
+    /// old generation heap space and be deduplicated if an identical string
+    /// already exists.
+    /// [Notes]
+    /// Internalized keys skip the internalization step on every property lookup. For hot keys, see StringCache.
+    pub fn initUtf8Internalized(isolate: Isolate, str: []const u8) Self {
+        return .{
+            .handle = c.v8__String__NewFromUtf8(isolate.handle, str.ptr, c.kInternalized, @intCast(str.len)).?,
+        };
+    }
+
     pub fn lenUtf8(self: Self, isolate: Isolate) u32 {
         return @intCast(c.v8__String__Utf8Length(self.handle, isolate.handle));
     }
@@ -1526,6 +3126,14 @@ pub const ScriptCompilerSource = struct {
     pub fn deinit(self: *Self) void {
         c.v8__ScriptCompiler__Source__DESTRUCT(&self.inner);
     }
+
+    /// After compiling with kConsumeCodeCache, returns whether V8 rejected the cached data,
+    /// eg. because the source or V8 version changed. A rejected cache should be regenerated.
+    pub fn isCacheRejected(self: *const Self) bool {
+        if (c.v8__ScriptCompiler__Source__GetCachedData(&self.inner)) |data| {
+            return data.*.rejected;
+        } else return false;
+    }
 };
 
 pub const ScriptCompilerCachedData = struct {
@@ -1539,19 +3147,24 @@ pub const ScriptCompilerCachedData = struct {
         };
     }
 
+    /// Not needed if the cached data was passed to ScriptCompilerSource.init, the source takes ownership.
     pub fn deinit(self: Self) void {
         c.v8__ScriptCompiler__CachedData__DELETE(self.handle);
     }
+
+    pub fn getData(self: Self) []const u8 {
+        return self.handle.data[0..@intCast(self.handle.length)];
+    }
 };
 
 pub const ScriptCompiler = struct {
-    const CompileOptions = enum(u32) {
+    pub const CompileOptions = enum(u32) {
         kNoCompileOptions = c.kNoCompileOptions,
         kConsumeCodeCache = c.kConsumeCodeCache,
         kEagerCompile = c.kEagerCompile,
     };
 
-    const NoCacheReason = enum(u32) {
+    pub const NoCacheReason = enum(u32) {
         kNoCacheNoReason = c.kNoCacheNoReason,
         kNoCacheBecauseCachingDisabled = c.kNoCacheBecauseCachingDisabled,
         kNoCacheBecauseNoResource = c.kNoCacheBecauseNoResource,
@@ -1569,6 +3182,126 @@ pub const ScriptCompiler = struct {
         kNoCacheBecauseDeferredProduceCodeCache = c.kNoCacheBecauseDeferredProduceCodeCache,
     };
 
+    /// [v8]
+    /// Compiles the specified script (bound to current context).
+    ///
+    /// Returns the compiled script object, bound to the context that was active
+    /// when this function was called. When run it will always use this
+    /// context.
+    pub fn compile(ctx: Context, src: *ScriptCompilerSource, options: ScriptCompiler.CompileOptions, reason: ScriptCompiler.NoCacheReason) !Script {
+        if (c.v8__ScriptCompiler__Compile(ctx.handle, &src.inner, @intCast(@intFromEnum(options)), @intCast(@intFromEnum(reason)))) |handle| {
+            return Script{
+                .handle = handle,
+            };
+        } else return error.JsException;
+    }
+
+    /// [v8]
+    /// Compiles the specified script (context-independent).
+    /// [Notes]
+    /// The result can be bound to many contexts with bindToCurrentContext, and its code cache is shared across them.
+    pub fn compileUnboundScript(iso: Isolate, src: *ScriptCompilerSource, options: ScriptCompiler.CompileOptions, reason: ScriptCompiler.NoCacheReason) !UnboundScript {
+        if (c.v8__ScriptCompiler__CompileUnboundScript(iso.handle, &src.inner, @intCast(@intFromEnum(options)), @intCast(@intFromEnum(reason)))) |handle| {
+            return UnboundScript{
+                .handle = handle,
+            };
+        } else return error.JsException;
+    }
+
+    pub const CachedCompileResult = struct {
+        script: UnboundScript,
+        /// False when there was no cache or V8 rejected it. Create a new cache after the next warm-up.
+        cache_accepted: bool,
+    };
+
+    /// Compiles src consuming a code cache produced by UnboundScript.createCodeCache after a previous warm-up.
+    /// Functions recorded in the cache are deserialized already compiled. Without a cache, V8's lazy compilation is used.
+    /// To compile top-level functions ahead of time instead, wrap them in parentheses, eg. `(function handler() {...})`,
+    /// which V8 treats as a hint to compile eagerly, or use compileUnboundScript with kEagerCompile.
+    pub fn compileWithCodeCache(iso: Isolate, src: String, origin: ?ScriptOrigin, cache: ?[]const u8) !CachedCompileResult {
+        var source: ScriptCompilerSource = undefined;
+        source.init(src, origin, if (cache) |data| ScriptCompilerCachedData.init(data) else null);
+        defer source.deinit();
+
+        const options: CompileOptions = if (cache != null) .kConsumeCodeCache else .kNoCompileOptions;
+        const script = try compileUnboundScript(iso, &source, options, .kNoCacheNoReason);
+        return .{
+            .script = script,
+            .cache_accepted = cache != null and !source.isCacheRejected(),
+        };
+    }
+
+    /// [v8]
+    /// Compile a function for a given context. This is equivalent to running
+    ///
+    /// with (obj) {
+    ///   return function(args) { ... }
+    /// }
+    ///
+    /// It is possible to specify multiple context extensions (obj in the above
+    /// example).
+    /// [Notes]
+    /// src is the function body only, so handlers don't need to be wrapped in a function expression string.
+    pub fn compileFunction(
+        ctx: Context,
+        src: *ScriptCompilerSource,
+        params: []const String,
+        context_extensions: []const Object,
+        options: ScriptCompiler.CompileOptions,
+        reason: ScriptCompiler.NoCacheReason,
+    ) !Function {
+        const c_params: ?[*]const ?*const c.String = @ptrCast(params.ptr);
+        const c_exts: ?[*]const ?*const c.Object = @ptrCast(context_extensions.ptr);
+        if (c.v8__ScriptCompiler__CompileFunction(
+            ctx.handle,
+            &src.inner,
+            params.len,
+            c_params,
+            context_extensions.len,
+            c_exts,
+            @intCast(@intFromEnum(options)),
+            @intCast(@intFromEnum(reason)),
+        )) |handle| {
+            return Function{
+                .handle = handle,
+            };
+        } else return error.JsException;
+    }
+
+    /// [v8]
+    /// Creates and returns code cache for the specified function that was
+    /// previously produced by CompileFunction.
+    /// This will return nullptr if the script cannot be serialized. The
+    /// CachedData returned by this function should be owned by the caller.
+    pub fn createCodeCacheForFunction(func: Function) ?ScriptCompilerCachedData {
+        if (c.v8__ScriptCompiler__CreateCodeCacheForFunction(func.handle)) |handle| {
+            return ScriptCompilerCachedData{
+                .handle = handle,
+            };
+        } else return null;
+    }
+
+    pub const CachedFunctionResult = struct {
+        func: Function,
+        /// False when there was no cache or V8 rejected it.
+        cache_accepted: bool,
+    };
+
+    /// Compiles a handler body into a Function with the given parameter names, consuming a per-handler cache
+    /// produced by createCodeCacheForFunction when given.
+    pub fn compileFunctionWithCodeCache(ctx: Context, body: String, origin: ?ScriptOrigin, params: []const String, cache: ?[]const u8) !CachedFunctionResult {
+        var source: ScriptCompilerSource = undefined;
+        source.init(body, origin, if (cache) |data| ScriptCompilerCachedData.init(data) else null);
+        defer source.deinit();
+
+        const options: CompileOptions = if (cache != null) .kConsumeCodeCache else .kNoCompileOptions;
+        const func = try compileFunction(ctx, &source, params, &.{}, options, .kNoCacheNoReason);
+        return .{
+            .func = func,
+            .cache_accepted = cache != null and !source.isCacheRejected(),
+        };
+    }
+
     /// [v8]
     /// Compile an ES module, returning a Module that encapsulates the compiled code.
     /// Corresponds to the ParseModule abstract operation in the ECMAScript specification.
@@ -1576,8 +3309,8 @@ pub const ScriptCompiler = struct {
         const mb_res = c.v8__ScriptCompiler__CompileModule(
             iso.handle,
             &src.inner,
-            @intCast(options),
-            @intCast(reason),
+            @intCast(@intFromEnum(options)),
+            @intCast(@intFromEnum(reason)),
         );
         if (mb_res) |res| {
             return Module{
@@ -1609,6 +3342,46 @@ pub const Script = struct {
             };
         } else return error.JsException;
     }
+
+    /// [v8]
+    /// Returns the corresponding context-unbound script.
+    pub fn getUnboundScript(self: Self) UnboundScript {
+        return .{
+            .handle = c.v8__Script__GetUnboundScript(self.handle).?,
+        };
+    }
+};
+
+/// [v8]
+/// A compiled JavaScript script, not yet tied to a Context.
+pub const UnboundScript = struct {
+    const Self = @This();
+
+    handle: *const c.UnboundScript,
+
+    /// [v8]
+    /// Binds the script to the currently entered context.
+    pub fn bindToCurrentContext(self: Self) Script {
+        return .{
+            .handle = c.v8__UnboundScript__BindToCurrentContext(self.handle).?,
+        };
+    }
+
+    /// [v8]
+    /// Creates and returns code cache for the specified unbound_script.
+    /// This will return nullptr if the script cannot be serialized. The
+    /// CachedData returned by this function should be owned by the caller.
+    /// [Notes]
+    /// The cache includes every function that has been compiled so far, not just the top level.
+    /// Creating it after a warm-up run records the hot functions, and consuming it on the next boot
+    /// restores them compiled, so first requests don't stall on lazy compilation.
+    pub fn createCodeCache(self: Self) ?ScriptCompilerCachedData {
+        if (c.v8__ScriptCompiler__CreateCodeCache(self.handle)) |handle| {
+            return ScriptCompilerCachedData{
+                .handle = handle,
+            };
+        } else return null;
+    }
 };
 
 pub const Module = struct {
@@ -1811,14 +3584,66 @@ pub const Value = struct {
         return c.v8__Value__IsArrayBuffer(self.handle);
     }
 
+    pub fn isSharedArrayBuffer(self: Self) bool {
+        return c.v8__Value__IsSharedArrayBuffer(self.handle);
+    }
+
     pub fn isArrayBufferView(self: Self) bool {
         return c.v8__Value__IsArrayBufferView(self.handle);
     }
 
+    pub fn isTypedArray(self: Self) bool {
+        return c.v8__Value__IsTypedArray(self.handle);
+    }
+
+    pub fn isInt8Array(self: Self) bool {
+        return c.v8__Value__IsInt8Array(self.handle);
+    }
+
     pub fn isUint8Array(self: Self) bool {
         return c.v8__Value__IsUint8Array(self.handle);
     }
 
+    pub fn isUint8ClampedArray(self: Self) bool {
+        return c.v8__Value__IsUint8ClampedArray(self.handle);
+    }
+
+    pub fn isInt16Array(self: Self) bool {
+        return c.v8__Value__IsInt16Array(self.handle);
+    }
+
+    pub fn isUint16Array(self: Self) bool {
+        return c.v8__Value__IsUint16Array(self.handle);
+    }
+
+    pub fn isInt32Array(self: Self) bool {
+        return c.v8__Value__IsInt32Array(self.handle);
+    }
+
+    pub fn isUint32Array(self: Self) bool {
+        return c.v8__Value__IsUint32Array(self.handle);
+    }
+
+    pub fn isFloat32Array(self: Self) bool {
+        return c.v8__Value__IsFloat32Array(self.handle);
+    }
+
+    pub fn isFloat64Array(self: Self) bool {
+        return c.v8__Value__IsFloat64Array(self.handle);
+    }
+
+    pub fn isBigInt64Array(self: Self) bool {
+        return c.v8__Value__IsBigInt64Array(self.handle);
+    }
+
+    pub fn isBigUint64Array(self: Self) bool {
+        return c.v8__Value__IsBigUint64Array(self.handle);
+    }
+
+    pub fn isDataView(self: Self) bool {
+        return c.v8__Value__IsDataView(self.handle);
+    }
+
     pub fn isExternal(self: Self) bool {
         return c.v8__Value__IsExternal(self.handle);
     }
@@ -1855,10 +3680,20 @@ pub const Value = struct {
         return c.v8__Value__IsBigIntObject(self.handle);
     }
 
+    pub fn isWasmModuleObject(self: Self) bool {
+        return c.v8__Value__IsWasmModuleObject(self.handle);
+    }
+
     /// Should only be called if you know the underlying type.
     pub fn castTo(self: Self, comptime T: type) T {
         switch (T) {
-            Object, Function, Array, Promise, External, Integer, ArrayBuffer, ArrayBufferView, Uint8Array, String => {
+            Object, Function, Array, Promise, External, Integer, ArrayBuffer, ArrayBufferView, String, WasmModuleObject, DataView, SharedArrayBuffer => {
+                return .{
+                    .handle = self.handle,
+                };
+            },
+            // Typed arrays.
+            Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array, BigInt64Array, BigUint64Array => {
                 return .{
                     .handle = self.handle,
                 };
@@ -1932,180 +3767,787 @@ pub const Promise = struct {
         } else return error.JsException;
     }
 
-    pub fn getState(self: Self) State {
-        return @intFromEnum(c.v8__Promise__State(self.handle));
+    pub fn getState(self: Self) State {
+        return @intFromEnum(c.v8__Promise__State(self.handle));
+    }
+
+    /// [V8]
+    /// Marks this promise as handled to avoid reporting unhandled rejections.
+    pub fn markAsHandled(self: Self) void {
+        c.v8__Promise__MarkAsHandled(self.handle);
+    }
+
+    pub fn toObject(self: Self) Object {
+        return .{
+            .handle = @ptrCast(self.handle),
+        };
+    }
+
+    /// [V8]
+    /// Returns the content of the [[PromiseResult]] field. The Promise must not be pending.
+    pub fn getResult(self: Self) Value {
+        return .{
+            .handle = c.v8__Promise__Result(self.handle).?,
+        };
+    }
+};
+
+pub const PromiseResolver = struct {
+    const Self = @This();
+
+    handle: *const c.PromiseResolver,
+
+    pub fn init(ctx: Context) Self {
+        return .{
+            .handle = c.v8__Promise__Resolver__New(ctx.handle).?,
+        };
+    }
+
+    pub fn getPromise(self: Self) Promise {
+        return .{
+            .handle = c.v8__Promise__Resolver__GetPromise(self.handle).?,
+        };
+    }
+
+    /// Resolve will continue execution of any yielding generators.
+    pub fn resolve(self: Self, ctx: Context, val: Value) ?bool {
+        var out: c.MaybeBool = undefined;
+        c.v8__Promise__Resolver__Resolve(self.handle, ctx.handle, val.handle, &out);
+        if (out.has_value == 1) {
+            return out.value == 1;
+        } else return null;
+    }
+
+    /// Reject will continue execution of any yielding generators.
+    pub fn reject(self: Self, ctx: Context, val: Value) ?bool {
+        var out: c.MaybeBool = undefined;
+        c.v8__Promise__Resolver__Reject(self.handle, ctx.handle, val.handle, &out);
+        if (out.has_value == 1) {
+            return out.value == 1;
+        } else return null;
+    }
+};
+
+pub const BackingStore = struct {
+    const Self = @This();
+
+    handle: *c.BackingStore,
+
+    /// Underlying handle is initially unmanaged.
+    pub fn init(iso: Isolate, len: usize) Self {
+        return .{
+            .handle = c.v8__ArrayBuffer__NewBackingStore(iso.handle, len).?,
+        };
+    }
+
+    /// Wraps embedder memory without copying. The deleter is invoked once V8 no longer references the memory,
+    /// which can be on any thread. This is how ownership of an existing Zig buffer is moved into JS:
+    /// call toSharedPtr and pass the result to ArrayBuffer.initWithBackingStore.
+    /// Like init, the underlying handle is initially unmanaged.
+    pub fn initWithDeleter(data: []u8, deleter: c.BackingStoreDeleterCallback, deleter_data: ?*anyopaque) Self {
+        return .{
+            .handle = c.v8__ArrayBuffer__NewBackingStore2(data.ptr, data.len, deleter, deleter_data).?,
+        };
+    }
+
+    /// Frees a backing store that was never converted with toSharedPtr.
+    pub fn deinit(self: Self) void {
+        c.v8__BackingStore__DELETE(self.handle);
+    }
+
+    /// [V8]
+    /// Wrapper around ArrayBuffer::Allocator::Reallocate that preserves IsShared.
+    /// Assumes that the backing_store was allocated by the ArrayBuffer allocator
+    /// of the given isolate.
+    /// [Notes]
+    /// Only stores from init or initShared qualify; calling this on an initWithDeleter or initResizable store is
+    /// undefined behavior. Only unmanaged stores (before toSharedPtr) can be reallocated. The old handle is consumed.
+    pub fn reallocate(self: Self, iso: Isolate, len: usize) Self {
+        return .{
+            .handle = c.v8__BackingStore__Reallocate(iso.handle, self.handle, len).?,
+        };
+    }
+
+    /// [V8]
+    /// Returns a new resizable standalone BackingStore that is allocated using the
+    /// array buffer allocator of the isolate. The result can be later passed to
+    /// ArrayBuffer::New.
+    ///
+    /// |byte_length| must be <= |max_byte_length|.
+    ///
+    /// This function is usable without an isolate. Unlike |NewBackingStore| calls
+    /// with an isolate, GCs cannot be triggered, and there are no
+    /// retries. Allocation failure will cause the function to crash with an
+    /// out-of-memory error.
+    /// [Notes]
+    /// The max length is reserved up front, so JS can grow the buffer with resize() without copying.
+    /// ArrayBuffer.prototype.resize is only exposed with the --harmony-rab-gsab flag in this V8.
+    pub fn initResizable(len: usize, max_len: usize) Self {
+        return .{
+            .handle = c.v8__ArrayBuffer__NewResizableBackingStore(len, max_len).?,
+        };
+    }
+
+    /// Creates a backing store for a SharedArrayBuffer. Like init, the underlying handle is initially unmanaged.
+    pub fn initShared(iso: Isolate, len: usize) Self {
+        return .{
+            .handle = c.v8__SharedArrayBuffer__NewBackingStore(iso.handle, len).?,
+        };
+    }
+
+    /// Returns null if len is 0.
+    pub fn getData(self: Self) ?*anyopaque {
+        return c.v8__BackingStore__Data(self.handle);
+    }
+
+    pub fn getByteLength(self: Self) usize {
+        return c.v8__BackingStore__ByteLength(self.handle);
+    }
+
+    pub fn isShared(self: Self) bool {
+        return c.v8__BackingStore__IsShared(self.handle);
+    }
+
+    /// [V8]
+    /// Indicates whether the backing store was created for a resizable ArrayBuffer
+    /// or a growable SharedArrayBuffer, and thus may be resized by user JavaScript
+    /// code.
+    pub fn isResizableByUserJavaScript(self: Self) bool {
+        return c.v8__BackingStore__IsResizableByUserJavaScript(self.handle);
+    }
+
+    pub fn toSharedPtr(self: Self) SharedPtr {
+        return c.v8__BackingStore__TO_SHARED_PTR(self.handle);
+    }
+
+    pub fn sharedPtrReset(ptr: *SharedPtr) void {
+        c.std__shared_ptr__v8__BackingStore__reset(ptr);
+    }
+
+    pub fn sharedPtrGet(ptr: *const SharedPtr) Self {
+        return .{
+            .handle = c.std__shared_ptr__v8__BackingStore__get(ptr).?,
+        };
+    }
+
+    pub fn sharedPtrUseCount(ptr: *const SharedPtr) u32 {
+        return @intCast(c.std__shared_ptr__v8__BackingStore__use_count(ptr));
+    }
+};
+
+pub const ArrayBuffer = struct {
+    const Self = @This();
+
+    handle: *const c.ArrayBuffer,
+
+    pub fn init(iso: Isolate, len: usize) Self {
+        return .{
+            .handle = c.v8__ArrayBuffer__New(iso.handle, len).?,
+        };
+    }
+
+    pub fn initWithBackingStore(iso: Isolate, store: *const SharedPtr) Self {
+        return .{
+            .handle = c.v8__ArrayBuffer__New2(iso.handle, store).?,
+        };
+    }
+
+    pub fn getBackingStore(self: Self) SharedPtr {
+        return c.v8__ArrayBuffer__GetBackingStore(self.handle);
+    }
+
+    pub fn getByteLength(self: Self) usize {
+        return c.v8__ArrayBuffer__ByteLength(self.handle);
+    }
+
+    /// [V8]
+    /// Returns true if this ArrayBuffer may be detached.
+    pub fn isDetachable(self: Self) bool {
+        return c.v8__ArrayBuffer__IsDetachable(self.handle);
+    }
+
+    /// [V8]
+    /// Returns true if this ArrayBuffer has been detached.
+    pub fn wasDetached(self: Self) bool {
+        return c.v8__ArrayBuffer__WasDetached(self.handle);
+    }
+
+    /// [V8]
+    /// Detaches this ArrayBuffer and all its views (typed arrays).
+    /// Detaching sets the byte length of the buffer and all typed arrays to zero,
+    /// preventing JavaScript from ever accessing underlying backing store.
+    /// ArrayBuffer should have been externalized and must be detachable. Returns
+    /// Nothing if the key didn't pass the [[ArrayBufferDetachKey]] check,
+    /// Just(true) otherwise.
+    /// [Notes]
+    /// Pass null as the key for buffers without a detach key.
+    pub fn detach(self: Self, key: ?Value) !void {
+        var out: c.MaybeBool = undefined;
+        c.v8__ArrayBuffer__Detach(self.handle, if (key) |k| k.handle else null, &out);
+        if (out.has_value != 1) {
+            return error.JsException;
+        }
+    }
+
+    /// [V8]
+    /// Sets the ArrayBufferDetachKey.
+    pub fn setDetachKey(self: Self, key: anytype) void {
+        c.v8__ArrayBuffer__SetDetachKey(self.handle, getValueHandle(key));
+    }
+
+    /// Takes the memory back from JS without copying: returns a reference to the backing store and detaches the buffer.
+    /// The returned SharedPtr must be released with BackingStore.sharedPtrReset or handed to another buffer with initWithBackingStore.
+    pub fn transfer(self: Self, key: ?Value) !SharedPtr {
+        if (!self.isDetachable()) {
+            return error.NotDetachable;
+        }
+        var store = self.getBackingStore();
+        self.detach(key) catch |err| {
+            BackingStore.sharedPtrReset(&store);
+            return err;
+        };
+        return store;
+    }
+};
+
+pub const SharedArrayBuffer = struct {
+    const Self = @This();
+
+    handle: *const c.SharedArrayBuffer,
+
+    pub fn init(iso: Isolate, len: usize) Self {
+        return .{
+            .handle = c.v8__SharedArrayBuffer__New(iso.handle, len).?,
+        };
+    }
+
+    /// The backing store must have been created with BackingStore.initShared.
+    pub fn initWithBackingStore(iso: Isolate, store: *const SharedPtr) Self {
+        return .{
+            .handle = c.v8__SharedArrayBuffer__New2(iso.handle, store).?,
+        };
+    }
+
+    pub fn getByteLength(self: Self) usize {
+        return c.v8__SharedArrayBuffer__ByteLength(self.handle);
     }
 
-    /// [V8]
-    /// Marks this promise as handled to avoid reporting unhandled rejections.
-    pub fn markAsHandled(self: Self) void {
-        c.v8__Promise__MarkAsHandled(self.handle);
+    pub fn getBackingStore(self: Self) SharedPtr {
+        return c.v8__SharedArrayBuffer__GetBackingStore(self.handle);
     }
 
-    pub fn toObject(self: Self) Object {
+    pub fn toValue(self: Self) Value {
         return .{
-            .handle = @ptrCast(self.handle),
+            .handle = self.handle,
         };
     }
+};
 
-    /// [V8]
-    /// Returns the content of the [[PromiseResult]] field. The Promise must not be pending.
-    pub fn getResult(self: Self) Value {
+/// [V8]
+/// Passed to the AtomicsWaitCallback. Wake can be called from any thread to
+/// stop the `Atomics.wait()` call it belongs to.
+pub const AtomicsWaitWakeHandle = struct {
+    const Self = @This();
+
+    handle: *c.AtomicsWaitWakeHandle,
+
+    pub fn initFromC(val: ?*c.AtomicsWaitWakeHandle) Self {
         return .{
-            .handle = c.v8__Promise__Result(self.handle).?,
+            .handle = val.?,
         };
     }
+
+    pub fn wake(self: Self) void {
+        c.v8__AtomicsWaitWakeHandle__Wake(self.handle);
+    }
 };
 
-pub const PromiseResolver = struct {
+/// Owns a reference to one shared backing store so that worker isolates can each create a SharedArrayBuffer over the same memory.
+/// init and deinit should be called by the owning thread. initSharedArrayBuffer can be called from any worker thread
+/// with that worker's isolate as long as the SharedMemory outlives the call. Each SharedArrayBuffer holds its own reference,
+/// so the memory stays alive until the last buffer is collected.
+pub const SharedMemory = struct {
     const Self = @This();
 
-    handle: *const c.PromiseResolver,
+    store: SharedPtr,
 
-    pub fn init(ctx: Context) Self {
+    pub fn init(iso: Isolate, len: usize) Self {
         return .{
-            .handle = c.v8__Promise__Resolver__New(ctx.handle).?,
+            .store = BackingStore.initShared(iso, len).toSharedPtr(),
         };
     }
 
-    pub fn getPromise(self: Self) Promise {
+    /// Shares the memory of an existing SharedArrayBuffer, eg. one that was created in JS.
+    pub fn initFromSharedArrayBuffer(buf: SharedArrayBuffer) Self {
         return .{
-            .handle = c.v8__Promise__Resolver__GetPromise(self.handle).?,
+            .store = buf.getBackingStore(),
         };
     }
 
-    /// Resolve will continue execution of any yielding generators.
-    pub fn resolve(self: Self, ctx: Context, val: Value) ?bool {
-        var out: c.MaybeBool = undefined;
-        c.v8__Promise__Resolver__Resolve(self.handle, ctx.handle, val.handle, &out);
-        if (out.has_value == 1) {
-            return out.value == 1;
-        } else return null;
+    pub fn deinit(self: *Self) void {
+        BackingStore.sharedPtrReset(&self.store);
     }
 
-    /// Reject will continue execution of any yielding generators.
-    pub fn reject(self: Self, ctx: Context, val: Value) ?bool {
-        var out: c.MaybeBool = undefined;
-        c.v8__Promise__Resolver__Reject(self.handle, ctx.handle, val.handle, &out);
-        if (out.has_value == 1) {
-            return out.value == 1;
-        } else return null;
+    pub fn initSharedArrayBuffer(self: *const Self, iso: Isolate) SharedArrayBuffer {
+        return SharedArrayBuffer.initWithBackingStore(iso, &self.store);
+    }
+
+    /// Access from Zig must be synchronized with the JS side, eg. with std.atomic or Atomics in JS.
+    pub fn getData(self: *const Self) []u8 {
+        const store = BackingStore.sharedPtrGet(&self.store);
+        const len = store.getByteLength();
+        if (len == 0) {
+            return &.{};
+        }
+        const data: [*]u8 = @ptrCast(store.getData().?);
+        return data[0..len];
     }
 };
 
-pub const BackingStore = struct {
+pub const ArrayBufferView = struct {
     const Self = @This();
 
-    handle: *c.BackingStore,
+    handle: *const c.ArrayBufferView,
 
-    /// Underlying handle is initially unmanaged.
-    pub fn init(iso: Isolate, len: usize) Self {
+    pub fn getBuffer(self: Self) ArrayBuffer {
         return .{
-            .handle = c.v8__ArrayBuffer__NewBackingStore(iso.handle, len).?,
+            .handle = c.v8__ArrayBufferView__Buffer(self.handle).?,
         };
     }
 
-    /// Returns null if len is 0.
-    pub fn getData(self: Self) ?*anyopaque {
-        return c.v8__BackingStore__Data(self.handle);
+    /// [V8]
+    /// Byte offset in |Buffer|.
+    pub fn getByteOffset(self: Self) usize {
+        return c.v8__ArrayBufferView__ByteOffset(self.handle);
     }
 
+    /// [V8]
+    /// Size of a view in bytes.
     pub fn getByteLength(self: Self) usize {
-        return c.v8__BackingStore__ByteLength(self.handle);
-    }
-
-    pub fn isShared(self: Self) bool {
-        return c.v8__BackingStore__IsShared(self.handle);
+        return c.v8__ArrayBufferView__ByteLength(self.handle);
     }
 
-    pub fn toSharedPtr(self: Self) SharedPtr {
-        return c.v8__BackingStore__TO_SHARED_PTR(self.handle);
+    /// [V8]
+    /// Copy the contents of the ArrayBufferView's buffer to an embedder defined
+    /// memory without additional overhead that calling ArrayBufferView::Buffer
+    /// might incur.
+    /// Returns the number of bytes actually written.
+    pub fn copyContents(self: Self, dest: []u8) usize {
+        return c.v8__ArrayBufferView__CopyContents(self.handle, dest.ptr, dest.len);
     }
 
-    pub fn sharedPtrReset(ptr: *SharedPtr) void {
-        c.std__shared_ptr__v8__BackingStore__reset(ptr);
+    /// [V8]
+    /// Returns true if ArrayBufferView's backing ArrayBuffer has already been
+    /// allocated.
+    pub fn hasBuffer(self: Self) bool {
+        return c.v8__ArrayBufferView__HasBuffer(self.handle);
     }
 
-    pub fn sharedPtrGet(ptr: *const SharedPtr) Self {
+    pub fn castFrom(val: anytype) Self {
+        const T = @TypeOf(val);
+        if (T != DataView and !@hasDecl(T, "Element")) {
+            @compileError(std.fmt.comptimePrint("{s} is not a subtype of v8::ArrayBufferView", .{@typeName(T)}));
+        }
         return .{
-            .handle = c.std__shared_ptr__v8__BackingStore__get(ptr).?,
+            .handle = @ptrCast(val.handle),
         };
     }
+};
+
+pub const FixedArray = struct {
+    const Self = @This();
+
+    handle: *const c.FixedArray,
+
+    pub fn length(self: Self) u32 {
+        return @intCast(c.v8__FixedArray__Length(self.handle));
+    }
 
-    pub fn sharedPtrUseCount(ptr: *const SharedPtr) u32 {
-        return @intCast(c.std__shared_ptr__v8__BackingStore__use_count(ptr));
+    pub fn get(self: Self, ctx: Context, idx: u32) Data {
+        return .{
+            .handle = c.v8__FixedArray__Get(self.handle, ctx.handle, @intCast(idx)).?,
+        };
     }
 };
 
-pub const ArrayBuffer = struct {
+pub const Int8Array = TypedArray(i8, c.v8__Int8Array__New);
+pub const Uint8Array = TypedArray(u8, c.v8__Uint8Array__New);
+pub const Uint8ClampedArray = TypedArray(u8, c.v8__Uint8ClampedArray__New);
+pub const Int16Array = TypedArray(i16, c.v8__Int16Array__New);
+pub const Uint16Array = TypedArray(u16, c.v8__Uint16Array__New);
+pub const Int32Array = TypedArray(i32, c.v8__Int32Array__New);
+pub const Uint32Array = TypedArray(u32, c.v8__Uint32Array__New);
+pub const Float32Array = TypedArray(f32, c.v8__Float32Array__New);
+pub const Float64Array = TypedArray(f64, c.v8__Float64Array__New);
+pub const BigInt64Array = TypedArray(i64, c.v8__BigInt64Array__New);
+pub const BigUint64Array = TypedArray(u64, c.v8__BigUint64Array__New);
+
+/// Returns a typed array type with element type Elem. new_fn is the C constructor for the concrete typed array.
+/// All typed arrays share the same interface, length is in elements and byte offsets/lengths are in bytes.
+pub fn TypedArray(comptime Elem: type, comptime new_fn: anytype) type {
+    return struct {
+        const Self = @This();
+
+        pub const Element = Elem;
+
+        handle: *const c.TypedArray,
+
+        /// len is the number of elements.
+        pub fn init(buf: ArrayBuffer, offset: usize, len: usize) Self {
+            return .{
+                .handle = new_fn(buf.handle, offset, len).?,
+            };
+        }
+
+        /// Returns the number of elements.
+        pub fn length(self: Self) usize {
+            return c.v8__TypedArray__Length(self.handle);
+        }
+
+        pub fn getByteOffset(self: Self) usize {
+            return c.v8__ArrayBufferView__ByteOffset(self.handle);
+        }
+
+        pub fn getByteLength(self: Self) usize {
+            return c.v8__ArrayBufferView__ByteLength(self.handle);
+        }
+
+        pub fn getBuffer(self: Self) ArrayBuffer {
+            return .{
+                .handle = c.v8__ArrayBufferView__Buffer(self.handle).?,
+            };
+        }
+
+        /// Returns a slice that aliases the backing store, no data is copied.
+        /// The slice is valid as long as the typed array is reachable and its buffer isn't detached.
+        /// Obtaining the buffer moves small on-heap typed arrays off the V8 heap, so the memory doesn't move afterwards.
+        pub fn getSlice(self: Self) []Elem {
+            const len = self.length();
+            if (len == 0) {
+                return &.{};
+            }
+            const data = getViewData(self.getBuffer(), self.getByteOffset());
+            return @as([*]Elem, @ptrCast(@alignCast(data)))[0..len];
+        }
+
+        /// Copies the contents into dest and returns the number of elements copied.
+        /// Unlike getSlice, this doesn't move on-heap typed arrays off the V8 heap.
+        pub fn copyContents(self: Self, dest: []Elem) usize {
+            const bytes = std.mem.sliceAsBytes(dest);
+            return c.v8__ArrayBufferView__CopyContents(self.handle, bytes.ptr, bytes.len) / @sizeOf(Elem);
+        }
+
+        pub fn toArrayBufferView(self: Self) ArrayBufferView {
+            return .{
+                .handle = self.handle,
+            };
+        }
+
+        pub fn toValue(self: Self) Value {
+            return .{
+                .handle = self.handle,
+            };
+        }
+    };
+}
+
+/// [V8]
+/// An instance of DataView constructor (ES6 draft 15.13.7).
+pub const DataView = struct {
     const Self = @This();
 
-    handle: *const c.ArrayBuffer,
+    handle: *const c.DataView,
 
-    pub fn init(iso: Isolate, len: usize) Self {
+    pub fn init(buf: ArrayBuffer, offset: usize, len: usize) Self {
         return .{
-            .handle = c.v8__ArrayBuffer__New(iso.handle, len).?,
+            .handle = c.v8__DataView__New(buf.handle, offset, len).?,
         };
     }
 
-    pub fn initWithBackingStore(iso: Isolate, store: *const SharedPtr) Self {
+    pub fn getByteOffset(self: Self) usize {
+        return c.v8__ArrayBufferView__ByteOffset(self.handle);
+    }
+
+    pub fn getByteLength(self: Self) usize {
+        return c.v8__ArrayBufferView__ByteLength(self.handle);
+    }
+
+    pub fn getBuffer(self: Self) ArrayBuffer {
         return .{
-            .handle = c.v8__ArrayBuffer__New2(iso.handle, store).?,
+            .handle = c.v8__ArrayBufferView__Buffer(self.handle).?,
         };
     }
 
-    pub fn getBackingStore(self: Self) SharedPtr {
-        return c.v8__ArrayBuffer__GetBackingStore(self.handle);
+    /// Returns the viewed bytes without copying. See TypedArray.getSlice for the lifetime rules.
+    pub fn getBytes(self: Self) []u8 {
+        const len = self.getByteLength();
+        if (len == 0) {
+            return &.{};
+        }
+        const data = getViewData(self.getBuffer(), self.getByteOffset());
+        return data[0..len];
+    }
+
+    pub fn toArrayBufferView(self: Self) ArrayBufferView {
+        return .{
+            .handle = self.handle,
+        };
+    }
+
+    pub fn toValue(self: Self) Value {
+        return .{
+            .handle = self.handle,
+        };
     }
 };
 
-pub const ArrayBufferView = struct {
+/// The returned pointer is kept alive by the ArrayBuffer, so the temporary shared ptr can be released right away.
+fn getViewData(buf: ArrayBuffer, byte_offset: usize) [*]u8 {
+    var store_ptr = buf.getBackingStore();
+    defer BackingStore.sharedPtrReset(&store_ptr);
+    const data: [*]u8 = @ptrCast(BackingStore.sharedPtrGet(&store_ptr).getData().?);
+    return data + byte_offset;
+}
+
+pub const WasmModuleObject = struct {
     const Self = @This();
 
-    handle: *const c.ArrayBufferView,
+    handle: *const c.WasmModuleObject,
 
-    pub fn getBuffer(self: Self) ArrayBuffer {
+    /// [V8]
+    /// Synchronously compiles a WebAssembly module from the provided uncompiled bytes.
+    pub fn compile(iso: Isolate, wire_bytes: []const u8) !Self {
+        if (c.v8__WasmModuleObject__Compile(iso.handle, wire_bytes.ptr, wire_bytes.len)) |handle| {
+            return Self{
+                .handle = handle,
+            };
+        } else return error.JsException;
+    }
+
+    /// Restores a module from machine code produced by CompiledWasmModule.serialize.
+    /// If V8 rejects the serialized data (eg. it was produced by a different V8 version or with different flags),
+    /// the module is compiled from wire_bytes instead. wire_bytes must be the same bytes the module was originally compiled from.
+    pub fn deserializeOrCompile(iso: Isolate, serialized_module: []const u8, wire_bytes: []const u8) !Self {
+        if (c.v8__WasmModuleObject__DeserializeOrCompile(iso.handle, serialized_module.ptr, serialized_module.len, wire_bytes.ptr, wire_bytes.len)) |handle| {
+            return Self{
+                .handle = handle,
+            };
+        } else return error.JsException;
+    }
+
+    /// [V8]
+    /// Efficiently re-create a WasmModuleObject, without recompiling, from
+    /// a CompiledWasmModule.
+    pub fn initFromCompiledModule(iso: Isolate, compiled_module: CompiledWasmModule) !Self {
+        if (c.v8__WasmModuleObject__FromCompiledModule(iso.handle, compiled_module.handle)) |handle| {
+            return Self{
+                .handle = handle,
+            };
+        } else return error.JsException;
+    }
+
+    /// [V8]
+    /// Get the compiled module for this module object. The compiled module can be
+    /// shared by several module objects.
+    /// [Notes]
+    /// The returned CompiledWasmModule is heap allocated and must be freed with deinit.
+    pub fn getCompiledModule(self: Self) CompiledWasmModule {
         return .{
-            .handle = c.v8__ArrayBufferView__Buffer(self.handle).?,
+            .handle = c.v8__WasmModuleObject__GetCompiledModule(self.handle).?,
         };
     }
 
-    pub fn castFrom(val: anytype) Self {
-        switch (@TypeOf(val)) {
-            Uint8Array => return .{
-                .handle = @ptrCast(val.handle),
-            },
-            else => unreachable,
+    /// Equivalent to js "new WebAssembly.Instance(module, imports)". Returns the instance object.
+    pub fn instantiate(self: Self, ctx: Context, imports: ?Object) !Object {
+        const iso = ctx.getIsolate();
+        const wasm = (try ctx.getGlobal().getValue(ctx, String.initUtf8(iso, "WebAssembly"))).castTo(Object);
+        const instance_ctor = (try wasm.getValue(ctx, String.initUtf8(iso, "Instance"))).castTo(Function);
+        if (imports) |imports_obj| {
+            return instance_ctor.initInstance(ctx, &.{ self.toValue(), imports_obj.toValue() }) orelse error.JsException;
+        } else {
+            return instance_ctor.initInstance(ctx, &.{self.toValue()}) orelse error.JsException;
         }
     }
+
+    pub fn toObject(self: Self) Object {
+        return .{
+            .handle = self.handle,
+        };
+    }
+
+    pub fn toValue(self: Self) Value {
+        return .{
+            .handle = self.handle,
+        };
+    }
 };
 
-pub const FixedArray = struct {
+/// [V8]
+/// Wrapper around a compiled WebAssembly module, which is potentially shared by
+/// different WasmModuleObjects.
+pub const CompiledWasmModule = struct {
     const Self = @This();
 
-    handle: *const c.FixedArray,
+    handle: *c.CompiledWasmModule,
 
-    pub fn length(self: Self) u32 {
-        return @intCast(c.v8__FixedArray__Length(self.handle));
+    pub fn deinit(self: Self) void {
+        c.v8__CompiledWasmModule__DELETE(self.handle);
     }
 
-    pub fn get(self: Self, ctx: Context, idx: u32) Data {
+    /// [V8]
+    /// Serialize the compiled module. The serialized data does not include the
+    /// wire bytes.
+    /// [Notes]
+    /// The result can be written to disk and passed to WasmModuleObject.deserializeOrCompile on the next run
+    /// to skip Liftoff/TurboFan compilation. It must be freed with deinit.
+    pub fn serialize(self: Self) OwnedBuffer {
+        var res: c.OwnedBuffer = undefined;
+        c.v8__CompiledWasmModule__Serialize(self.handle, &res);
         return .{
-            .handle = c.v8__FixedArray__Get(self.handle, ctx.handle, @intCast(idx)).?,
+            .inner = res,
         };
     }
+
+    /// [V8]
+    /// Get the (wasm-encoded) wire bytes that were used to compile this module.
+    pub fn getWireBytes(self: Self) []const u8 {
+        var len: usize = 0;
+        const ptr = c.v8__CompiledWasmModule__GetWireBytesRef(self.handle, &len);
+        if (len == 0) {
+            return &.{};
+        }
+        return ptr[0..len];
+    }
+
+    pub fn getSourceUrl(self: Self) []const u8 {
+        var len: usize = 0;
+        const ptr = c.v8__CompiledWasmModule__SourceUrl(self.handle, &len);
+        if (len == 0) {
+            return "";
+        }
+        return ptr[0..len];
+    }
 };
 
-pub const Uint8Array = struct {
+/// [V8]
+/// The V8 interface for WebAssembly streaming compilation. When streaming
+/// compilation is initiated, V8 passes a WasmStreaming object to the
+/// embedder. The embedder then uses the WasmStreaming object to pass bytes
+/// to V8 while compilation runs on background threads.
+/// [Notes]
+/// The returned promise of compileStreaming only settles after the platform's message loop has been pumped.
+pub const WasmStreaming = struct {
     const Self = @This();
 
-    handle: *const c.Uint8Array,
+    /// Chunk size used by feedFile.
+    pub const ChunkSize = 64 * 1024;
 
-    pub fn init(buf: ArrayBuffer, offset: usize, len: usize) Self {
+    inner: SharedPtr,
+
+    /// Should be called from the streaming callback set by Isolate.setWasmStreamingCallback with the callback's data value.
+    /// The returned WasmStreaming holds a reference to the stream and must be released with deinit.
+    pub fn unpack(iso: Isolate, data: Value) Self {
         return .{
-            .handle = c.v8__Uint8Array__New(buf.handle, offset, len).?,
+            .inner = c.v8__WasmStreaming__Unpack(iso.handle, data.handle),
         };
     }
+
+    pub fn deinit(self: *Self) void {
+        c.std__shared_ptr__v8__WasmStreaming__reset(&self.inner);
+    }
+
+    /// Equivalent to js "WebAssembly.compileStreaming(source)". The source is handed to the streaming callback as its first arg.
+    pub fn compileStreaming(ctx: Context, source: anytype) !Promise {
+        const iso = ctx.getIsolate();
+        const wasm = (try ctx.getGlobal().getValue(ctx, String.initUtf8(iso, "WebAssembly"))).castTo(Object);
+        const compile_fn = (try wasm.getValue(ctx, String.initUtf8(iso, "compileStreaming"))).castTo(Function);
+        const res = compile_fn.call(ctx, wasm, &.{Value{ .handle = getValueHandle(source) }}) orelse return error.JsException;
+        return res.castTo(Promise);
+    }
+
+    /// [V8]
+    /// Pass a new chunk of bytes to WebAssembly streaming compilation.
+    /// The buffer passed into OnBytesReceived is owned by the caller.
+    pub fn onBytesReceived(self: Self, bytes: []const u8) void {
+        c.v8__WasmStreaming__OnBytesReceived(&self.inner, bytes.ptr, bytes.len);
+    }
+
+    /// [V8]
+    /// Finish should be called after all received bytes where passed to
+    /// OnBytesReceived to tell V8 that there will be no more bytes. Finish must
+    /// not be called after Abort has been called already.
+    /// If {can_use_compiled_module} is true and {SetCompiledModuleBytes} was
+    /// previously called, the compiled module bytes can be used.
+    pub fn finish(self: Self, can_use_compiled_module: bool) void {
+        c.v8__WasmStreaming__Finish(&self.inner, can_use_compiled_module);
+    }
+
+    /// [V8]
+    /// Abort streaming compilation. If {exception} has a value, then the promise
+    /// associated with streaming compilation is rejected with that value. If
+    /// {exception} does not have value, the promise does not get rejected.
+    pub fn abort(self: Self, exception: ?Value) void {
+        c.v8__WasmStreaming__Abort(&self.inner, if (exception) |val| val.handle else null);
+    }
+
+    /// [V8]
+    /// Passes previously compiled module bytes. This must be called before
+    /// {OnBytesReceived}, {Finish}, or {Abort}. Returns true if the module bytes
+    /// can be used, false otherwise.
+    pub fn setCompiledModuleBytes(self: Self, bytes: []const u8) bool {
+        return c.v8__WasmStreaming__SetCompiledModuleBytes(&self.inner, bytes.ptr, bytes.len);
+    }
+
+    /// [V8]
+    /// Sets the UTF-8 encoded source URL for the {Script} object. This must be
+    /// called before {Finish}.
+    pub fn setUrl(self: Self, url: []const u8) void {
+        c.v8__WasmStreaming__SetUrl(&self.inner, url.ptr, url.len);
+    }
+
+    /// Streams the rest of the file into the compiler in ChunkSize chunks and then calls finish.
+    /// Only one chunk is buffered at a time, so compilation overlaps with the reads
+    /// and the whole module never needs to be held in memory.
+    pub fn feedFile(self: Self, iso: Isolate, file: std.fs.File) !void {
+        var buf: [ChunkSize]u8 = undefined;
+        try self.feedReader(iso, file.reader(), &buf);
+    }
+
+    /// Streams from any reader using buf as the chunk buffer and then calls finish.
+    /// If the reader fails, the compilation is aborted, its promise is rejected with an Error named after the
+    /// read error and the error is returned.
+    pub fn feedReader(self: Self, iso: Isolate, reader: anytype, buf: []u8) !void {
+        while (true) {
+            const n = reader.read(buf) catch |err| {
+                self.abort(Exception.initError(String.initUtf8(iso, @errorName(err))));
+                return err;
+            };
+            if (n == 0) {
+                break;
+            }
+            self.onBytesReceived(buf[0..n]);
+        }
+        self.finish(true);
+    }
+};
+
+/// [V8]
+/// An owned byte buffer with associated size.
+pub const OwnedBuffer = struct {
+    const Self = @This();
+
+    inner: c.OwnedBuffer,
+
+    pub fn deinit(self: *Self) void {
+        c.v8__OwnedBuffer__DELETE(&self.inner);
+    }
+
+    pub fn getData(self: Self) []const u8 {
+        if (self.inner.size == 0) {
+            return &.{};
+        }
+        return self.inner.data[0..self.inner.size];
+    }
 };
 
 pub const Json = struct {
@@ -2144,4 +4586,12 @@ test "Internals." {
     try eq(c.v8__ScriptCompiler__Source__SIZEOF(), @sizeOf(c.ScriptCompilerSource));
     try eq(c.v8__ScriptCompiler__CachedData__SIZEOF(), @sizeOf(c.ScriptCompilerCachedData));
     try eq(c.v8__HeapStatistics__SIZEOF(), @sizeOf(c.HeapStatistics));
+    try eq(c.v8__Global__SIZEOF(), @sizeOf(c.Global));
+    try eq(c.v8__HandleScope__SIZEOF(), @sizeOf(c.HandleScope));
+    try eq(c.v8__EscapableHandleScope__SIZEOF(), @sizeOf(c.EscapableHandleScope));
+    try eq(c.v8__SealHandleScope__SIZEOF(), @sizeOf(c.SealHandleScope));
+    try eq(c.v8__Eternal__SIZEOF(), @sizeOf(c.Eternal));
+    try eq(c.v8__TracedReference__SIZEOF(), @sizeOf(c.TracedReference));
+    try eq(c.v8__GcMember__SIZEOF(), @sizeOf(c.GcMember));
+    try eq(c.v8__MicrotasksScope__SIZEOF(), @sizeOf(c.MicrotasksScope));
 }